@@ -0,0 +1,65 @@
+//
+// Created by taylor-santos on 10/16/2026 at 21:05.
+//
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+#include "obj.hpp"
+#include "scene_file.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double
+millisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+} // namespace
+
+// Converts a Wavefront OBJ file into a memory-mappable .glpt scene with a prebuilt BVH.
+int
+main(int argc, char **argv) {
+    if (argc != 3) {
+        std::cerr << "usage: " << argv[0] << " input.obj output.glpt\n";
+        return EXIT_FAILURE;
+    }
+    try {
+        std::cout << std::fixed << std::setprecision(1);
+
+        auto start = Clock::now();
+        auto scene = glpt::loadObj(argv[1]);
+        std::cout << "parsed " << scene.mesh.triangles.size() << " triangles, "
+                  << scene.materials.size() << " materials in " << millisecondsSince(start)
+                  << " ms\n";
+
+        start = Clock::now();
+        // Only the binary BVH is stored, so skip the wide one that commit() would build.
+        // SceneFileOptions::buildWideBvh rebuilds it from the binary one at load time.
+        scene.bvh = glpt::BVH::build(scene.mesh.view());
+        scene.findLights();
+        std::cout << "built BVH with " << scene.bvh.nodes().size() << " nodes in "
+                  << millisecondsSince(start) << " ms\n";
+
+        start = Clock::now();
+        if (!glpt::writeSceneFile(scene.view(), argv[2])) {
+            std::cerr << "failed to write " << argv[2] << '\n';
+            return EXIT_FAILURE;
+        }
+        std::cout << "wrote " << argv[2] << " in " << millisecondsSince(start) << " ms\n";
+
+        start = Clock::now();
+        glpt::SceneFile file(argv[2]);
+        std::cout << "mapped and verified it in " << std::setprecision(3)
+                  << millisecondsSince(start) << " ms\n";
+    } catch (const std::exception &e) {
+        std::cerr << "error: " << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,59 @@
+//
+// Created by taylor-santos on 10/16/2026 at 09:12.
+//
+
+#pragma once
+
+#include <limits>
+
+#include <glm/glm.hpp>
+
+namespace glpt {
+
+struct AABB {
+    glm::vec3 min{std::numeric_limits<float>::infinity()};
+    glm::vec3 max{-std::numeric_limits<float>::infinity()};
+
+    void
+    grow(const glm::vec3 &p) {
+        min = glm::min(min, p);
+        max = glm::max(max, p);
+    }
+
+    void
+    grow(const AABB &other) {
+        min = glm::min(min, other.min);
+        max = glm::max(max, other.max);
+    }
+
+    [[nodiscard]] bool
+    empty() const {
+        return min.x > max.x || min.y > max.y || min.z > max.z;
+    }
+
+    [[nodiscard]] glm::vec3
+    extent() const {
+        return max - min;
+    }
+
+    [[nodiscard]] glm::vec3
+    center() const {
+        return (min + max) * 0.5f;
+    }
+
+    // Half of the surface area, which is all the SAH needs since only ratios are compared.
+    [[nodiscard]] float
+    halfArea() const {
+        if (empty()) return 0.0f;
+        glm::vec3 e = extent();
+        return e.x * e.y + e.y * e.z + e.z * e.x;
+    }
+
+    [[nodiscard]] bool
+    contains(const AABB &other) const {
+        return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z &&
+               max.x >= other.max.x && max.y >= other.max.y && max.z >= other.max.z;
+    }
+};
+
+} // namespace glpt
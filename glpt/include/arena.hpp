@@ -0,0 +1,69 @@
+//
+// Created by taylor-santos on 10/16/2026 at 20:48.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "span.hpp"
+
+namespace glpt {
+
+// Bump allocator for scratch data that all dies at the same time, typically at the end of a
+// frame. Allocation is a pointer increment; nothing is freed individually, and destructors are
+// never run, so only trivially destructible types may be placed in an arena.
+//
+// reset() rewinds to the start but keeps the memory. If the previous cycle spilled into more than
+// one block they are merged into a single block big enough for all of it, so a workload that
+// repeats every frame stops touching the heap after its first frame.
+//
+// Not thread safe: give each thread its own arena.
+class Arena {
+public:
+    explicit Arena(std::size_t blockSize = 64 * 1024);
+
+    Arena(const Arena &) = delete;
+    Arena &
+    operator=(const Arena &) = delete;
+    Arena(Arena &&) noexcept = default;
+    Arena &
+    operator=(Arena &&) noexcept = default;
+
+    [[nodiscard]] void *
+    allocate(std::size_t bytes, std::size_t alignment);
+
+    // count copies of value. T is meant to be given explicitly.
+    template<typename T>
+    [[nodiscard]] span<T>
+    allocate(std::size_t count, const T &value = T{}) {
+        static_assert(std::is_trivially_destructible_v<T>);
+        auto *data = static_cast<T *>(allocate(count * sizeof(T), alignof(T)));
+        std::uninitialized_fill_n(data, count, value);
+        return {data, count};
+    }
+
+    void
+    reset();
+
+    // Bytes owned across all blocks.
+    [[nodiscard]] std::size_t
+    capacity() const;
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t                  size;
+    };
+
+    std::size_t        blockSize_;
+    std::vector<Block> blocks_;
+    // Block being bumped and the offset of its first free byte.
+    std::size_t current_ = 0;
+    std::size_t offset_  = 0;
+};
+
+} // namespace glpt
@@ -0,0 +1,267 @@
+//
+// Created by taylor-santos on 10/16/2026 at 09:47.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "aabb.hpp"
+#include "mesh.hpp"
+#include "profiler.hpp"
+#include "ray.hpp"
+#include "span.hpp"
+
+namespace glpt {
+
+// A single node of the flattened BVH. Nodes are stored in depth-first order, so the left child
+// of an interior node is always the node directly after it and only the right child index needs
+// to be stored. The layout matches a std430 struct of {vec3, uint, vec3, uint}, so the node
+// array can be uploaded to a shader storage buffer unchanged.
+struct BVHNode {
+    glm::vec3 min;
+    uint32_t  offset; // Interior: index of the right child. Leaf: first entry in primIndices.
+    glm::vec3 max;
+    uint32_t  count; // Number of triangles in a leaf, 0 for interior nodes.
+
+    [[nodiscard]] bool
+    isLeaf() const {
+        return count != 0;
+    }
+
+    [[nodiscard]] AABB
+    bounds() const {
+        return {min, max};
+    }
+};
+
+static_assert(sizeof(BVHNode) == 32, "BVHNode must stay 32 bytes to match the GPU layout");
+
+struct BVHBuildOptions {
+    uint32_t binCount         = 16;
+    uint32_t maxLeafSize      = 8;
+    float    traversalCost    = 1.0f;
+    float    intersectionCost = 1.0f;
+    // Ranges with fewer triangles than this are built on the calling thread.
+    uint32_t parallelThreshold = 16 * 1024;
+    // 0 selects std::thread::hardware_concurrency().
+    unsigned threadCount = 0;
+    // BVH::update rebuilds instead of refitting once the SAH cost grows past this multiple of
+    // the cost the tree had right after it was built.
+    float rebuildThreshold = 1.3f;
+};
+
+enum class BVHUpdate {
+    Refit,
+    Rebuild,
+};
+
+// Non-owning view over flattened BVH data. Traversal only ever goes through a view so that the
+// node and index arrays can come from a BVH, a mapped file, or anywhere else.
+struct BVHView {
+    // Traversal uses a fixed-size stack, so the builder never produces a deeper tree than this.
+    static constexpr uint32_t maxDepth = 64;
+
+    span<const BVHNode>  nodes;
+    span<const uint32_t> primIndices;
+
+    [[nodiscard]] bool
+    empty() const {
+        return nodes.empty();
+    }
+
+    // Finds the closest hit in (ray.tMin, min(ray.tMax, hit.t)). Returns true and updates hit if
+    // one was found.
+    bool
+    intersect(const Ray &ray, const MeshView &mesh, Hit &hit) const;
+
+    // Returns true if anything is hit in (ray.tMin, ray.tMax).
+    [[nodiscard]] bool
+    occluded(const Ray &ray, const MeshView &mesh) const;
+
+    // Visits the leaves the ray enters before tMax, nearest first, skipping subtrees that start
+    // beyond the closest hit so far. leaf(node, tMax) tests the primitives of a leaf and returns
+    // true if it found a hit, after lowering tMax to it. Returns true if any leaf did. With
+    // AnyHit, the first hit ends the traversal.
+    template<bool AnyHit, typename LeafFn>
+    bool
+    traverse(const Ray &ray, float tMax, profile::TraversalCounter &counter, LeafFn &&leaf) const;
+
+    // Tests the triangles of a leaf, keeping the closest hit before tMax. Meant as the leaf
+    // callback of traverse.
+    template<bool AnyHit>
+    bool
+    intersectLeaf(const BVHNode &node, const Ray &ray, const MeshView &mesh, float &tMax, Hit &hit)
+        const;
+};
+
+class BVH {
+public:
+    BVH() = default;
+
+    // Builds a binned SAH BVH over every triangle of the mesh.
+    static BVH
+    build(const MeshView &mesh, const BVHBuildOptions &options = {});
+
+    // Builds a BVH over arbitrary primitives, given the bounds of each.
+    static BVH
+    build(span<const AABB> primBounds, const BVHBuildOptions &options = {});
+
+    // Recomputes every node's bounds bottom-up in O(n) without changing the tree, after the
+    // primitives moved. The mesh must have the same triangles the tree was built over. Throws
+    // std::invalid_argument if the number of primitives changed.
+    void
+    refit(const MeshView &mesh);
+
+    void
+    refit(span<const AABB> primBounds);
+
+    // Refits, or rebuilds from scratch once refitting has raised sahCost() above
+    // options.rebuildThreshold times its value right after the last build. Same requirements as
+    // refit() unless the tree is empty, in which case it is simply built.
+    BVHUpdate
+    update(const MeshView &mesh, const BVHBuildOptions &options = {});
+
+    BVHUpdate
+    update(span<const AABB> primBounds, const BVHBuildOptions &options = {});
+
+    // Expected cost of tracing a ray through the tree under the surface area heuristic, relative
+    // to intersecting the root box. Lower is better.
+    [[nodiscard]] float
+    sahCost(const BVHBuildOptions &options = {}) const;
+
+    [[nodiscard]] BVHView
+    view() const {
+        return {nodes_, primIndices_};
+    }
+
+    [[nodiscard]] span<const BVHNode>
+    nodes() const {
+        return nodes_;
+    }
+
+    [[nodiscard]] span<const uint32_t>
+    primIndices() const {
+        return primIndices_;
+    }
+
+    [[nodiscard]] AABB
+    bounds() const {
+        return nodes_.empty() ? AABB{} : nodes_.front().bounds();
+    }
+
+    bool
+    intersect(const Ray &ray, const MeshView &mesh, Hit &hit) const {
+        return view().intersect(ray, mesh, hit);
+    }
+
+    [[nodiscard]] bool
+    occluded(const Ray &ray, const MeshView &mesh) const {
+        return view().occluded(ray, mesh);
+    }
+
+private:
+    std::vector<BVHNode>  nodes_;
+    std::vector<uint32_t> primIndices_;
+    // sahCost() right after the last build, the baseline for update().
+    float builtCost_ = 0.0f;
+
+    void
+    checkPrimitiveCount(std::size_t count) const;
+};
+
+template<bool AnyHit, typename LeafFn>
+bool
+BVHView::traverse(const Ray &ray, float tMax, profile::TraversalCounter &counter, LeafFn &&leaf)
+    const {
+    if (nodes.empty()) return false;
+
+    struct StackEntry {
+        uint32_t node;
+        float    tNear;
+    };
+
+    glm::vec3 invDir = 1.0f / ray.direction;
+    float     tNear;
+    if (!intersectBox(ray, invDir, nodes[0].min, nodes[0].max, tMax, tNear)) return false;
+
+    StackEntry stack[maxDepth];
+    uint32_t   stackSize = 0;
+    uint32_t   index     = 0;
+    bool       found     = false;
+    while (true) {
+        const BVHNode &node = nodes[index];
+        counter.visitNode();
+        if (node.isLeaf()) {
+            if (leaf(node, tMax)) {
+                if constexpr (AnyHit) return true;
+                found = true;
+            }
+        } else {
+            uint32_t near = index + 1;
+            uint32_t far  = node.offset;
+            float    tNearChild, tFarChild;
+            bool     hitNear =
+                intersectBox(ray, invDir, nodes[near].min, nodes[near].max, tMax, tNearChild);
+            bool hitFar =
+                intersectBox(ray, invDir, nodes[far].min, nodes[far].max, tMax, tFarChild);
+            if (hitNear && hitFar) {
+                if (tFarChild < tNearChild) {
+                    std::swap(near, far);
+                    std::swap(tNearChild, tFarChild);
+                }
+                stack[stackSize++] = {far, tFarChild};
+                index              = near;
+                continue;
+            }
+            if (hitNear || hitFar) {
+                index = hitNear ? near : far;
+                continue;
+            }
+        }
+
+        // Pop the next subtree that could still contain a closer hit.
+        do {
+            if (stackSize == 0) return found;
+            stackSize--;
+        } while (stack[stackSize].tNear > tMax);
+        index = stack[stackSize].node;
+    }
+}
+
+template<bool AnyHit>
+bool
+BVHView::intersectLeaf(
+    const BVHNode  &node,
+    const Ray      &ray,
+    const MeshView &mesh,
+    float          &tMax,
+    Hit            &hit) const {
+    bool found = false;
+    for (uint32_t i = node.offset; i < node.offset + node.count; i++) {
+        uint32_t          prim = primIndices[i];
+        const glm::uvec3 &tri  = mesh.triangles[prim];
+        float             t, u, v;
+        if (intersectTriangle(
+                ray,
+                mesh.positions[tri.x],
+                mesh.positions[tri.y],
+                mesh.positions[tri.z],
+                tMax,
+                t,
+                u,
+                v)) {
+            if constexpr (AnyHit) return true;
+            tMax  = t;
+            hit   = {t, u, v, prim};
+            found = true;
+        }
+    }
+    return found;
+}
+
+} // namespace glpt
@@ -0,0 +1,39 @@
+//
+// Created by taylor-santos on 10/16/2026 at 13:52.
+//
+
+#pragma once
+
+#include <cmath>
+
+#include <glm/glm.hpp>
+
+#include "ray.hpp"
+
+namespace glpt {
+
+struct Camera {
+    glm::vec3 position{0.0f};
+    glm::vec3 target{0.0f, 0.0f, -1.0f};
+    glm::vec3 up{0.0f, 1.0f, 0.0f};
+    float     verticalFov = glm::radians(45.0f);
+
+    // Pinhole ray through film coordinates (u, v) in [0, 1]^2, with (0, 0) at the top left.
+    [[nodiscard]] Ray
+    generateRay(float u, float v, float aspect) const {
+        glm::vec3 forward    = glm::normalize(target - position);
+        glm::vec3 right      = glm::normalize(glm::cross(forward, up));
+        glm::vec3 trueUp     = glm::cross(right, forward);
+        float     halfHeight = std::tan(verticalFov * 0.5f);
+        float     halfWidth  = halfHeight * aspect;
+
+        Ray ray;
+        ray.origin    = position;
+        ray.direction = glm::normalize(
+            forward + right * ((2.0f * u - 1.0f) * halfWidth) +
+            trueUp * ((1.0f - 2.0f * v) * halfHeight));
+        return ray;
+    }
+};
+
+} // namespace glpt
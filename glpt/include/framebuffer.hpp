@@ -0,0 +1,123 @@
+//
+// Created by taylor-santos on 10/16/2026 at 17:05.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "image.hpp"
+#include "renderer.hpp"
+
+namespace glpt {
+
+// Running per-pixel statistics: the radiance sum plus what's needed for the variance of the
+// mean luminance.
+struct PixelAccumulator {
+    glm::vec3 sum{0.0f};
+    float     luminanceSquaredSum = 0.0f;
+    uint32_t  count               = 0;
+    bool      converged           = false;
+
+    void
+    add(const glm::vec3 &sample);
+
+    [[nodiscard]] glm::vec3
+    mean() const {
+        return count ? sum * (1.0f / static_cast<float>(count)) : glm::vec3{0.0f};
+    }
+
+    // Standard error of the mean luminance relative to the mean itself. Infinite with fewer than
+    // two samples.
+    [[nodiscard]] float
+    relativeError() const;
+};
+
+// Floating-point accumulation buffer for progressive rendering, split into the same tiles the
+// renderer schedules.
+//
+// Accumulators are only touched by the worker currently rendering that tile, so they need no
+// synchronization. When a worker finishes a tile it publishes the tile's means through a
+// per-tile lock-free triple buffer: it fills its private back buffer and atomically swaps it with
+// the shared middle one. Readers swap the middle buffer into their own front buffer, so a
+// snapshot never blocks a render thread and never sees a half-written tile.
+class Framebuffer {
+public:
+    Framebuffer(uint32_t width, uint32_t height, uint32_t tileSize);
+
+    [[nodiscard]] const TileGrid &
+    grid() const {
+        return grid_;
+    }
+
+    // Writer side. Only one thread may work on a given tile at a time.
+
+    // Accumulator of pixel (x, y), which must lie inside the tile being worked on.
+    [[nodiscard]] PixelAccumulator &
+    accumulator(uint32_t x, uint32_t y) {
+        return accumulators_[slot(x, y)];
+    }
+
+    // Whether every pixel of the tile has converged, so the tile can be skipped entirely.
+    [[nodiscard]] bool
+    tileConverged(uint32_t tile) const {
+        return tileConverged_[tile] != 0;
+    }
+
+    // Publishes the current means of the tile to readers and updates its convergence flag.
+    void
+    publish(uint32_t tile);
+
+    // Clears all accumulated samples and published tiles. Must not run concurrently with
+    // writers; readers may still be active.
+    void
+    reset();
+
+    // Reader side. Safe to call from any thread at any time.
+
+    // Copies the most recently published version of every tile into image, resizing it if
+    // needed. Each tile is internally consistent; different tiles may be from different passes.
+    void
+    snapshot(Image &image) const;
+
+private:
+    static constexpr uint32_t dirtyBit = 4;
+
+    TileGrid grid_;
+    uint32_t tilePixels_;
+
+    std::vector<PixelAccumulator> accumulators_;
+    std::vector<uint8_t>          tileConverged_;
+
+    // Three published buffers per tile, each tilePixels_ long, laid out tile by tile.
+    std::vector<glm::vec3> published_;
+    // Per tile buffer index (0-2) owned by the writer.
+    std::vector<uint8_t> back_;
+    // Per tile shared buffer index, with dirtyBit set when it holds data the reader hasn't seen.
+    std::unique_ptr<std::atomic<uint32_t>[]> middle_;
+
+    // Reader state. Snapshots are serialized against each other, never against writers.
+    mutable std::mutex           readerMutex_;
+    mutable std::vector<uint8_t> front_;
+
+    [[nodiscard]] std::size_t
+    slot(uint32_t x, uint32_t y) const;
+
+    [[nodiscard]] glm::vec3 *
+    buffer(uint32_t tile, uint32_t index) {
+        return published_.data() + (static_cast<std::size_t>(tile) * 3 + index) * tilePixels_;
+    }
+
+    [[nodiscard]] const glm::vec3 *
+    buffer(uint32_t tile, uint32_t index) const {
+        return published_.data() + (static_cast<std::size_t>(tile) * 3 + index) * tilePixels_;
+    }
+};
+
+} // namespace glpt
@@ -0,0 +1,47 @@
+//
+// Created by taylor-santos on 10/16/2026 at 14:58.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace glpt {
+
+// Linear, floating-point RGB image stored row by row from the top.
+struct Image {
+    uint32_t               width  = 0;
+    uint32_t               height = 0;
+    std::vector<glm::vec3> pixels;
+
+    Image() = default;
+
+    Image(uint32_t width, uint32_t height)
+        : width{width}
+        , height{height}
+        , pixels(static_cast<std::size_t>(width) * height, glm::vec3{0.0f}) {}
+
+    [[nodiscard]] glm::vec3 &
+    at(uint32_t x, uint32_t y) {
+        return pixels[static_cast<std::size_t>(y) * width + x];
+    }
+
+    [[nodiscard]] const glm::vec3 &
+    at(uint32_t x, uint32_t y) const {
+        return pixels[static_cast<std::size_t>(y) * width + x];
+    }
+};
+
+// Clamps a linear value to [0, 1] and encodes it as an 8-bit sRGB value.
+unsigned char
+encodeSRGB(float linear);
+
+// Writes an 8-bit binary PPM after clamping and sRGB encoding. Returns false on I/O failure.
+bool
+writePPM(const Image &image, const std::string &path);
+
+} // namespace glpt
@@ -0,0 +1,76 @@
+//
+// Created by taylor-santos on 10/16/2026 at 14:32.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+#include "camera.hpp"
+#include "profiler.hpp"
+#include "random.hpp"
+#include "ray.hpp"
+#include "scene.hpp"
+
+namespace glpt {
+
+struct IntegratorSettings {
+    uint32_t maxBounces = 8;
+    // Russian roulette starts after this many bounces.
+    uint32_t rouletteDepth = 3;
+};
+
+// Offset applied along the normal to keep secondary rays from re-hitting their origin.
+inline constexpr float rayEpsilon = 1e-4f;
+
+// Random number stream for one sample of one pixel. Seeding per (pixel, sample) instead of per
+// thread makes every image independent of tiling, thread count and scheduling order.
+inline Pcg32
+pixelSampler(uint32_t pixel, uint32_t sample, uint32_t seed) {
+    return Pcg32((static_cast<uint64_t>(sample) << 32u) | pixel, seed);
+}
+
+// Primary ray through a uniformly jittered point of pixel (x, y). Consumes two random numbers.
+inline Ray
+primaryRay(
+    const Camera &camera,
+    uint32_t      x,
+    uint32_t      y,
+    uint32_t      width,
+    uint32_t      height,
+    Pcg32        &rng) {
+    float u = (static_cast<float>(x) + rng.nextFloat()) / static_cast<float>(width);
+    float v = (static_cast<float>(y) + rng.nextFloat()) / static_cast<float>(height);
+    return camera.generateRay(u, v, static_cast<float>(width) / static_cast<float>(height));
+}
+
+struct LightSample {
+    glm::vec3 direction{0.0f};
+    float     distance = 0.0f;
+    // Emitted radiance divided by the solid angle pdf, or zero if the sample is unusable.
+    glm::vec3 weight{0.0f};
+};
+
+// Picks an emissive triangle uniformly and a uniform point on it, as seen from point. Always
+// consumes three random numbers so that the stream stays in lockstep across integrators.
+LightSample
+sampleLight(const SceneView &scene, const glm::vec3 &point, Pcg32 &rng);
+
+// Megakernel estimator: follows one camera path to completion with next-event estimation on
+// Lambertian surfaces and returns its radiance.
+glm::vec3
+tracePath(const SceneView &scene, Ray ray, Pcg32 &rng, const IntegratorSettings &settings = {});
+
+// Same, timing the shading of every path vertex into shade, so that a renderer can record the
+// Shade zone once per tile.
+glm::vec3
+tracePath(
+    const SceneView          &scene,
+    Ray                       ray,
+    Pcg32                    &rng,
+    const IntegratorSettings &settings,
+    profile::ZoneAccumulator &shade);
+
+} // namespace glpt
@@ -0,0 +1,50 @@
+//
+// Created by taylor-santos on 10/16/2026 at 19:10.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "span.hpp"
+
+namespace glpt {
+
+// Read-only memory mapping of a whole file. Pages are loaded lazily by the OS, so files larger
+// than physical memory can be mapped and only the parts that are touched become resident.
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    // Throws std::runtime_error if the file can't be opened or mapped.
+    explicit MappedFile(const std::string &path);
+
+    ~MappedFile();
+
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &
+    operator=(MappedFile &&other) noexcept;
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &
+    operator=(const MappedFile &) = delete;
+
+    [[nodiscard]] span<const std::byte>
+    bytes() const {
+        return {data_, size_};
+    }
+
+private:
+    const std::byte *data_ = nullptr;
+    std::size_t      size_ = 0;
+#ifdef _WIN32
+    void *file_    = nullptr;
+    void *mapping_ = nullptr;
+#endif
+
+    void
+    close();
+};
+
+} // namespace glpt
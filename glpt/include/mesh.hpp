@@ -0,0 +1,59 @@
+//
+// Created by taylor-santos on 10/16/2026 at 09:31.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "aabb.hpp"
+#include "span.hpp"
+
+namespace glpt {
+
+// Non-owning view of an indexed triangle mesh. Everything that only reads geometry (BVH build,
+// traversal, rendering) takes a MeshView so that the backing memory can live anywhere.
+struct MeshView {
+    span<const glm::vec3>  positions;
+    span<const glm::uvec3> triangles;
+
+    [[nodiscard]] std::size_t
+    triangleCount() const {
+        return triangles.size();
+    }
+
+    [[nodiscard]] AABB
+    triangleBounds(std::size_t i) const {
+        const glm::uvec3 &tri = triangles[i];
+        AABB              box;
+        box.grow(positions[tri.x]);
+        box.grow(positions[tri.y]);
+        box.grow(positions[tri.z]);
+        return box;
+    }
+};
+
+// Geometric normal of a triangle, following its winding (not normalized).
+inline glm::vec3
+triangleNormal(const MeshView &mesh, uint32_t prim) {
+    const glm::uvec3 &tri = mesh.triangles[prim];
+    return glm::cross(
+        mesh.positions[tri.y] - mesh.positions[tri.x],
+        mesh.positions[tri.z] - mesh.positions[tri.x]);
+}
+
+struct Mesh {
+    std::vector<glm::vec3>  positions;
+    std::vector<glm::uvec3> triangles;
+
+    [[nodiscard]] MeshView
+    view() const {
+        return {positions, triangles};
+    }
+};
+
+} // namespace glpt
@@ -0,0 +1,22 @@
+//
+// Created by taylor-santos on 10/16/2026 at 20:30.
+//
+
+#pragma once
+
+#include <string>
+
+#include "scene.hpp"
+
+namespace glpt {
+
+// Loads a Wavefront OBJ file. Supports vertices, faces of any size (fan-triangulated, with
+// positive or negative indices in any of the v, v/vt, v//vn and v/vt/vn forms), and materials
+// from mtllib files with their Kd and Ke colors. Everything else is ignored. The camera is placed
+// on the +z side looking at the whole model.
+//
+// The returned scene is not committed. Throws std::runtime_error on I/O or syntax errors.
+Scene
+loadObj(const std::string &path);
+
+} // namespace glpt
@@ -0,0 +1,70 @@
+//
+// Created by taylor-santos on 10/16/2026 at 09:38.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "bvh.hpp"
+#include "mesh.hpp"
+#include "scene.hpp"
+#include "tlas.hpp"
+
+namespace glpt {
+
+// Deterministic "random soup" of small triangles scattered through the unit cube. The same
+// count and seed always produce the same mesh on every platform.
+Mesh
+makeTriangleSoup(std::size_t count, uint32_t seed);
+
+// Planar quad split into two triangles, wound counter-clockwise as listed.
+Mesh
+makeQuad(const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c, const glm::vec3 &d);
+
+// Box with outward-facing triangles, rotated by angle radians around the vertical axis.
+Mesh
+makeBox(const glm::vec3 &center, const glm::vec3 &size, float angle);
+
+// The classic Cornell box in the unit cube, open towards +z, lit by a small ceiling quad, with
+// the camera already set up. The returned scene is committed and ready to render.
+Scene
+makeCornellBox();
+
+// makeTriangleSoup(count, seed) lit by an area light above it, with the camera looking at it.
+// Committed like makeCornellBox. Stresses traversal with deep, incoherent paths.
+Scene
+makeSoupScene(std::size_t count, uint32_t seed);
+
+// A scene whose instances share one BLAS. The TLAS points into blasMesh and blasBvh, so it can be
+// moved but not copied.
+struct InstancedScene {
+    Scene scene;
+    Mesh  blasMesh;
+    BVH   blasBvh;
+    TLAS  tlas;
+
+    InstancedScene() = default;
+    InstancedScene(InstancedScene &&) = default;
+    InstancedScene &
+    operator=(InstancedScene &&) = default;
+
+    InstancedScene(const InstancedScene &) = delete;
+    InstancedScene &
+    operator=(const InstancedScene &) = delete;
+
+    [[nodiscard]] SceneView
+    view() const {
+        SceneView view = scene.view();
+        view.tlas      = &tlas;
+        return view;
+    }
+};
+
+// makeCornellBox with count small cubes scattered over the floor as instances of a single BLAS,
+// each in one of a few colors. The same count and seed always produce the same placements.
+InstancedScene
+makeInstancedCornellBox(uint32_t count, uint32_t seed);
+
+} // namespace glpt
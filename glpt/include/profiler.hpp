@@ -0,0 +1,300 @@
+//
+// Created by taylor-santos on 10/16/2026 at 22:40.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Built-in instrumentation: scoped zone timers, event counters and an optional event trace.
+//
+// Zones are recorded with GLPT_PROFILE_SCOPE and counters with TraversalCounter, which both
+// compile to nothing unless GLPT_PROFILING is defined (the GLPT_ENABLE_PROFILING CMake option).
+// The functions in glpt::profile are always available, so tools don't need their own #ifdefs;
+// without GLPT_PROFILING they simply report nothing.
+//
+// Every thread writes only to its own record, so recording never takes a lock or contends on a
+// cache line. Readers sum the records of all threads.
+
+namespace glpt::profile {
+
+enum class Zone : uint32_t {
+    BVHBuild,
+    WideBVHBuild,
+    BVHRefit,
+    WideBVHRefit,
+    RenderTile,
+    // Path vertices in the megakernel integrator: material lookup, next event estimation with
+    // its shadow ray, and sampling the next bounce. Recorded once per tile through a
+    // ZoneAccumulator, so its calls are tiles and it is not traced.
+    Shade,
+    WavefrontGenerate,
+    WavefrontExtend,
+    WavefrontSort,
+    WavefrontShade,
+    WavefrontConnect,
+    // A thread pool worker that ran out of tasks, waiting for the others to finish theirs.
+    Idle,
+    Count,
+};
+
+enum class Counter : uint32_t {
+    Rays,
+    ShadowRays,
+    // BVH nodes whose children were tested against a ray.
+    NodeVisits,
+    // Ray-triangle tests, counting every lane of a SIMD packet.
+    TriangleTests,
+    Count,
+};
+
+inline constexpr auto zoneCount    = static_cast<std::size_t>(Zone::Count);
+inline constexpr auto counterCount = static_cast<std::size_t>(Counter::Count);
+
+#ifdef GLPT_PROFILING
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+[[nodiscard]] const char *
+name(Zone zone);
+
+[[nodiscard]] const char *
+name(Counter counter);
+
+struct ZoneStats {
+    uint64_t calls       = 0;
+    uint64_t nanoseconds = 0;
+
+    [[nodiscard]] double
+    milliseconds() const {
+        return static_cast<double>(nanoseconds) * 1e-6;
+    }
+};
+
+struct ThreadStats {
+    // Small, stable id of the thread. Ids are reused after a thread exits.
+    uint32_t                           thread = 0;
+    std::array<ZoneStats, zoneCount>   zones{};
+    std::array<uint64_t, counterCount> counters{};
+};
+
+struct Stats {
+    std::vector<ThreadStats> threads;
+
+    [[nodiscard]] ZoneStats
+    total(Zone zone) const;
+
+    [[nodiscard]] uint64_t
+    total(Counter counter) const;
+};
+
+// Totals recorded since the last reset(), per thread. Doesn't block the threads being profiled.
+[[nodiscard]] Stats
+stats();
+
+// Zeroes all zones and counters and drops traced events. Only exact while nothing is being
+// recorded, e.g. between frames. Also claims the calling thread's record, which allocates the
+// first time, so that the frame after it doesn't; thread pool workers claim theirs on start.
+void
+reset();
+
+// While enabled, every zone is also logged as an event for writeChromeTrace. Each thread keeps
+// up to maxTraceEvents events; later ones are dropped. Enabling allocates the buffers for every
+// thread seen so far, so call it between frames rather than from a profiled thread.
+void
+setTracing(bool enabled);
+
+inline constexpr uint32_t maxTraceEvents = 1u << 16;
+
+// Writes the traced events in the Chrome trace event format, for chrome://tracing or Perfetto.
+// Must not run while events are being recorded. Returns false on I/O failure.
+bool
+writeChromeTrace(const std::string &path);
+
+// Draws a window summarizing stats() with Dear ImGui. Call between ImGui::NewFrame and
+// ImGui::Render.
+void
+drawOverlay(const Stats &stats, bool *open = nullptr);
+
+namespace detail {
+
+struct TraceEvent {
+    Zone     zone;
+    uint64_t start;
+    uint64_t duration;
+};
+
+// Written only by its owning thread, with plain loads and stores on relaxed atomics so that
+// readers on other threads never see torn values. Aligned to a cache line so that threads don't
+// share one; MSVC warns (C4324) about the padding that adds, which is the point.
+#ifdef _MSC_VER
+#    pragma warning(push)
+#    pragma warning(disable : 4324)
+#endif
+struct alignas(64) ThreadRecord {
+    uint32_t                                        id = 0;
+    std::array<std::atomic<uint64_t>, zoneCount>    zoneCalls{};
+    std::array<std::atomic<uint64_t>, zoneCount>    zoneNanoseconds{};
+    std::array<std::atomic<uint64_t>, counterCount> counters{};
+    std::unique_ptr<TraceEvent[]>                   events;
+    std::atomic<uint32_t>                           eventCount{0};
+};
+#ifdef _MSC_VER
+#    pragma warning(pop)
+#endif
+
+extern std::atomic<bool> tracing;
+
+// Record of the calling thread, claimed on first use.
+ThreadRecord &
+threadRecord();
+
+// Nanoseconds on a monotonic clock.
+uint64_t
+now();
+
+inline void
+add(std::atomic<uint64_t> &value, uint64_t amount) {
+    value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+void
+record(Zone zone, uint64_t start, uint64_t end);
+
+// Adds to the totals of a zone without tracing it.
+void
+accumulate(Zone zone, uint64_t calls, uint64_t nanoseconds);
+
+} // namespace detail
+
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Zone zone)
+        : zone_{zone}
+        , start_{detail::now()} {}
+
+    ~ScopedTimer() {
+        detail::record(zone_, start_, detail::now());
+    }
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &
+    operator=(const ScopedTimer &) = delete;
+
+private:
+    Zone     zone_;
+    uint64_t start_;
+};
+
+// Sums many short stretches of one zone in a local variable and records them as a single call
+// when it goes out of scope, e.g. all path vertices shaded in a tile. Each stretch still reads
+// the clock twice (tens of nanoseconds), which shows up in the enclosing zones, but the thread
+// record is only touched once.
+class ZoneAccumulator {
+public:
+#ifdef GLPT_PROFILING
+    explicit ZoneAccumulator(Zone zone)
+        : zone_{zone} {}
+
+    ~ZoneAccumulator() {
+        if (nanoseconds_ > 0) detail::accumulate(zone_, 1, nanoseconds_);
+    }
+#else
+    explicit ZoneAccumulator(Zone) {}
+#endif
+
+    ZoneAccumulator(const ZoneAccumulator &) = delete;
+    ZoneAccumulator &
+    operator=(const ZoneAccumulator &) = delete;
+
+    // Times its own lifetime into the accumulator.
+    class Stretch {
+    public:
+#ifdef GLPT_PROFILING
+        explicit Stretch(ZoneAccumulator &accumulator)
+            : accumulator_{accumulator}
+            , start_{detail::now()} {}
+
+        ~Stretch() {
+            accumulator_.nanoseconds_ += detail::now() - start_;
+        }
+#else
+        explicit Stretch(ZoneAccumulator &) {}
+#endif
+
+        Stretch(const Stretch &) = delete;
+        Stretch &
+        operator=(const Stretch &) = delete;
+
+#ifdef GLPT_PROFILING
+    private:
+        ZoneAccumulator &accumulator_;
+        uint64_t         start_;
+#endif
+    };
+
+#ifdef GLPT_PROFILING
+private:
+    Zone     zone_;
+    uint64_t nanoseconds_ = 0;
+#endif
+};
+
+// Accumulates the work done for one ray in registers and adds it to the thread's counters when
+// it goes out of scope, so traversal loops pay for a single counter update per ray.
+class TraversalCounter {
+public:
+#ifdef GLPT_PROFILING
+    explicit TraversalCounter(bool shadow)
+        : shadow_{shadow} {}
+
+    ~TraversalCounter() {
+        auto &counters = detail::threadRecord().counters;
+        auto  rays     = shadow_ ? Counter::ShadowRays : Counter::Rays;
+        detail::add(counters[static_cast<std::size_t>(rays)], 1);
+        detail::add(counters[static_cast<std::size_t>(Counter::NodeVisits)], nodes_);
+        detail::add(counters[static_cast<std::size_t>(Counter::TriangleTests)], triangles_);
+    }
+
+    void
+    visitNode() {
+        nodes_++;
+    }
+
+    void
+    testTriangles(uint32_t count) {
+        triangles_ += count;
+    }
+
+private:
+    bool     shadow_;
+    uint32_t nodes_     = 0;
+    uint32_t triangles_ = 0;
+#else
+    explicit TraversalCounter(bool) {}
+
+    void
+    visitNode() {}
+
+    void
+    testTriangles(uint32_t) {}
+#endif
+};
+
+} // namespace glpt::profile
+
+#ifdef GLPT_PROFILING
+#    define GLPT_PROFILE_CONCAT_(a, b) a##b
+#    define GLPT_PROFILE_CONCAT(a, b)  GLPT_PROFILE_CONCAT_(a, b)
+#    define GLPT_PROFILE_SCOPE(zone) \
+        ::glpt::profile::ScopedTimer GLPT_PROFILE_CONCAT(glptProfileScope, __LINE__) { zone }
+#else
+#    define GLPT_PROFILE_SCOPE(zone) static_cast<void>(0)
+#endif
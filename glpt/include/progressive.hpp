@@ -0,0 +1,81 @@
+//
+// Created by taylor-santos on 10/16/2026 at 17:48.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "framebuffer.hpp"
+#include "integrator.hpp"
+#include "scene.hpp"
+#include "thread_pool.hpp"
+
+namespace glpt {
+
+struct ProgressiveSettings {
+    uint32_t           width          = 512;
+    uint32_t           height         = 512;
+    uint32_t           tileSize       = 16;
+    uint32_t           samplesPerPass = 1;
+    uint32_t           seed           = 0;
+    IntegratorSettings integrator     = {};
+    // A pixel stops receiving samples once the standard error of its mean luminance falls below
+    // this fraction of the mean. Zero disables adaptive sampling.
+    float    errorThreshold = 0.0f;
+    // Samples a pixel takes before its error estimate is trusted.
+    uint32_t minSamples = 16;
+};
+
+// Accumulates samples into a Framebuffer one pass at a time, so an image can be shown (or
+// written) while it converges.
+//
+// Sample s of a pixel always uses pixelSampler(pixel, s, seed), so after n passes with adaptive
+// sampling disabled the image is bit-identical to render() with n * samplesPerPass samples.
+class ProgressiveRenderer {
+public:
+    explicit ProgressiveRenderer(const ProgressiveSettings &settings);
+
+    // Adds samplesPerPass samples to every unconverged pixel. Blocks until the pass is done, so a
+    // viewer should call it from its own render thread. Returns the number of samples traced.
+    uint64_t
+    renderPass(const SceneView &scene, ThreadPool &pool);
+
+    // Discards all samples, e.g. after the camera or scene changed. Must not run concurrently
+    // with renderPass.
+    void
+    reset();
+
+    // Copies the latest published state of every tile. Safe to call from any thread while a pass
+    // is running; it never waits for the render threads.
+    void
+    snapshot(Image &image) const {
+        framebuffer_.snapshot(image);
+    }
+
+    [[nodiscard]] const ProgressiveSettings &
+    settings() const {
+        return settings_;
+    }
+
+    // Number of completed passes since construction or the last reset.
+    [[nodiscard]] uint32_t
+    passes() const {
+        return passes_.load(std::memory_order_relaxed);
+    }
+
+    // Whether adaptive sampling has stopped every pixel.
+    [[nodiscard]] bool
+    converged() const {
+        return converged_.load(std::memory_order_relaxed);
+    }
+
+private:
+    ProgressiveSettings   settings_;
+    Framebuffer           framebuffer_;
+    std::atomic<uint32_t> passes_{0};
+    std::atomic<bool>     converged_{false};
+};
+
+} // namespace glpt
@@ -0,0 +1,42 @@
+//
+// Created by taylor-santos on 10/16/2026 at 09:41.
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace glpt {
+
+// PCG32 (O'Neill, XSH-RR variant). Used instead of <random> engines and distributions so that
+// sequences are bit-identical across standard libraries.
+class Pcg32 {
+public:
+    explicit Pcg32(uint64_t seed, uint64_t stream = 0)
+        : inc_{(stream << 1u) | 1u} {
+        next();
+        state_ += seed;
+        next();
+    }
+
+    uint32_t
+    next() {
+        uint64_t old = state_;
+        state_       = old * 6364136223846793005ULL + inc_;
+        auto xorshifted = static_cast<uint32_t>(((old >> 18u) ^ old) >> 27u);
+        auto rot        = static_cast<uint32_t>(old >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((~rot + 1u) & 31u));
+    }
+
+    // Uniform float in [0, 1).
+    float
+    nextFloat() {
+        return static_cast<float>(next() >> 8u) * 0x1p-24f;
+    }
+
+private:
+    uint64_t state_ = 0;
+    uint64_t inc_;
+};
+
+} // namespace glpt
@@ -0,0 +1,88 @@
+//
+// Created by taylor-santos on 10/16/2026 at 09:20.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include <glm/glm.hpp>
+
+namespace glpt {
+
+struct Ray {
+    glm::vec3 origin{0.0f};
+    glm::vec3 direction{0.0f, 0.0f, 1.0f};
+    float     tMin = 0.0f;
+    float     tMax = std::numeric_limits<float>::infinity();
+};
+
+struct Hit {
+    static constexpr uint32_t invalid = ~uint32_t{0};
+
+    float    t    = std::numeric_limits<float>::infinity();
+    float    u    = 0.0f;
+    float    v    = 0.0f;
+    uint32_t prim = invalid;
+
+    [[nodiscard]] bool
+    valid() const {
+        return prim != invalid;
+    }
+};
+
+// Möller–Trumbore. Writes t, u, v only when the hit lies inside (ray.tMin, tMax).
+inline bool
+intersectTriangle(
+    const Ray       &ray,
+    const glm::vec3 &v0,
+    const glm::vec3 &v1,
+    const glm::vec3 &v2,
+    float            tMax,
+    float           &t,
+    float           &u,
+    float           &v) {
+    constexpr float epsilon = 1e-9f;
+
+    glm::vec3 e1  = v1 - v0;
+    glm::vec3 e2  = v2 - v0;
+    glm::vec3 p   = glm::cross(ray.direction, e2);
+    float     det = glm::dot(e1, p);
+    if (det > -epsilon && det < epsilon) return false;
+    float     invDet = 1.0f / det;
+    glm::vec3 s      = ray.origin - v0;
+    float     bu     = glm::dot(s, p) * invDet;
+    if (bu < 0.0f || bu > 1.0f) return false;
+    glm::vec3 q  = glm::cross(s, e1);
+    float     bv = glm::dot(ray.direction, q) * invDet;
+    if (bv < 0.0f || bu + bv > 1.0f) return false;
+    float bt = glm::dot(e2, q) * invDet;
+    if (bt <= ray.tMin || bt >= tMax) return false;
+    t = bt;
+    u = bu;
+    v = bv;
+    return true;
+}
+
+// Slab test against a box given the precomputed reciprocal ray direction. On a hit, tNear is
+// the entry distance clamped to ray.tMin.
+inline bool
+intersectBox(
+    const Ray       &ray,
+    const glm::vec3 &invDir,
+    const glm::vec3 &boxMin,
+    const glm::vec3 &boxMax,
+    float            tMax,
+    float           &tNear) {
+    glm::vec3 t0    = (boxMin - ray.origin) * invDir;
+    glm::vec3 t1    = (boxMax - ray.origin) * invDir;
+    glm::vec3 tLow  = glm::min(t0, t1);
+    glm::vec3 tHigh = glm::max(t0, t1);
+    float     enter = glm::max(glm::max(tLow.x, tLow.y), glm::max(tLow.z, ray.tMin));
+    float     exit  = glm::min(glm::min(tHigh.x, tHigh.y), glm::min(tHigh.z, tMax));
+    tNear           = enter;
+    return enter <= exit;
+}
+
+} // namespace glpt
@@ -0,0 +1,75 @@
+//
+// Created by taylor-santos on 10/16/2026 at 15:10.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "image.hpp"
+#include "integrator.hpp"
+#include "scene.hpp"
+#include "thread_pool.hpp"
+
+namespace glpt {
+
+struct RenderSettings {
+    uint32_t           width           = 512;
+    uint32_t           height          = 512;
+    uint32_t           samplesPerPixel = 16;
+    uint32_t           tileSize        = 16;
+    uint32_t           seed            = 0;
+    IntegratorSettings integrator      = {};
+};
+
+// Pixel rectangle [x0, x1) x [y0, y1).
+struct TileRect {
+    uint32_t x0;
+    uint32_t y0;
+    uint32_t x1;
+    uint32_t y1;
+};
+
+// Screen-space tile grid shared by the CPU renderers. Tiles are numbered row by row.
+struct TileGrid {
+    uint32_t width;
+    uint32_t height;
+    uint32_t tileSize;
+
+    [[nodiscard]] uint32_t
+    columns() const {
+        return (width + tileSize - 1) / tileSize;
+    }
+
+    [[nodiscard]] uint32_t
+    rows() const {
+        return (height + tileSize - 1) / tileSize;
+    }
+
+    [[nodiscard]] uint32_t
+    count() const {
+        return columns() * rows();
+    }
+
+    [[nodiscard]] TileRect
+    rect(uint32_t tile) const {
+        uint32_t x0 = tile % columns() * tileSize;
+        uint32_t y0 = tile / columns() * tileSize;
+        return {x0, y0, std::min(x0 + tileSize, width), std::min(y0 + tileSize, height)};
+    }
+};
+
+// Renders the scene on the CPU with no window or GL context. The frame is cut into tiles that
+// are spread over the pool's workers. The result is a pure function of the scene and settings:
+// for a given build it is bit-identical for any thread count and tile size. Matching other
+// integrators bit for bit also needs FMA contraction off, which glpt/CMakeLists.txt ensures.
+Image
+render(const SceneView &scene, const RenderSettings &settings, ThreadPool &pool);
+
+// Same as above, but renders into image and reuses its storage if it already has the right size,
+// so rendering a sequence of frames never touches the heap.
+void
+render(const SceneView &scene, const RenderSettings &settings, ThreadPool &pool, Image &image);
+
+} // namespace glpt
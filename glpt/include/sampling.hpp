@@ -0,0 +1,45 @@
+//
+// Created by taylor-santos on 10/16/2026 at 14:20.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include <glm/glm.hpp>
+
+namespace glpt {
+
+constexpr float pi = 3.14159265358979323846f;
+
+// Builds tangent and bitangent vectors perpendicular to the unit vector n (Duff et al. 2017).
+inline void
+orthonormalBasis(const glm::vec3 &n, glm::vec3 &tangent, glm::vec3 &bitangent) {
+    float sign = std::copysign(1.0f, n.z);
+    float a    = -1.0f / (sign + n.z);
+    float b    = n.x * n.y * a;
+    tangent    = {1.0f + sign * n.x * n.x * a, sign * b, -sign * n.x};
+    bitangent  = {b, sign + n.y * n.y * a, -n.y};
+}
+
+// Cosine-weighted direction in the hemisphere around the unit vector n. The pdf is cos / pi.
+inline glm::vec3
+sampleCosineHemisphere(const glm::vec3 &n, float u1, float u2) {
+    float     r   = std::sqrt(u1);
+    float     phi = 2.0f * pi * u2;
+    glm::vec3 tangent, bitangent;
+    orthonormalBasis(n, tangent, bitangent);
+    return glm::normalize(
+        tangent * (r * std::cos(phi)) + bitangent * (r * std::sin(phi)) +
+        n * std::sqrt(std::max(0.0f, 1.0f - u1)));
+}
+
+// Uniformly distributed point on a triangle.
+inline glm::vec3
+sampleTriangle(const glm::vec3 &v0, const glm::vec3 &v1, const glm::vec3 &v2, float u1, float u2) {
+    float s = std::sqrt(u1);
+    return v0 * (1.0f - s) + v1 * (s * (1.0f - u2)) + v2 * (s * u2);
+}
+
+} // namespace glpt
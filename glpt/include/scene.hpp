@@ -0,0 +1,120 @@
+//
+// Created by taylor-santos on 10/16/2026 at 14:03.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "bvh.hpp"
+#include "camera.hpp"
+#include "mesh.hpp"
+#include "span.hpp"
+#include "tlas.hpp"
+#include "wide_bvh.hpp"
+
+namespace glpt {
+
+// Lambertian surface, optionally emissive on its front face (counter-clockwise winding).
+struct Material {
+    glm::vec3 albedo{0.8f};
+    glm::vec3 emission{0.0f};
+
+    [[nodiscard]] bool
+    isEmissive() const {
+        return emission.x > 0.0f || emission.y > 0.0f || emission.z > 0.0f;
+    }
+};
+
+// Everything the renderers read, as non-owning views.
+struct SceneView {
+    MeshView             mesh;
+    BVHView              bvh;
+    span<const Material> materials;
+    // Material index of every triangle.
+    span<const uint32_t> triangleMaterials;
+    // Indices of the triangles with an emissive material, used for light sampling.
+    span<const uint32_t> lights;
+    Camera               camera;
+    // Optional SIMD acceleration structure over the same triangles. Traversal falls back to
+    // the binary BVH when it is null.
+    const NativeBVH *wideBvh = nullptr;
+    // Optional instanced geometry, traced together with mesh. Instances are never sampled as
+    // lights, so an emissive instance material only shows where camera rays hit it directly.
+    const TLAS      *tlas    = nullptr;
+
+    // Closest hit in the mesh or, with a TLAS, in any instance. hit.instance is Hit::invalid
+    // for mesh triangles.
+    bool
+    intersect(const Ray &ray, InstanceHit &hit) const {
+        bool found = wideBvh ? wideBvh->intersect(ray, hit) : bvh.intersect(ray, mesh, hit);
+        // The TLAS only reports hits closer than the one already in hit.
+        if (tlas && tlas->intersect(ray, hit)) found = true;
+        return found;
+    }
+
+    [[nodiscard]] bool
+    occluded(const Ray &ray) const {
+        bool blocked = wideBvh ? wideBvh->occluded(ray) : bvh.occluded(ray, mesh);
+        return blocked || (tlas && tlas->occluded(ray));
+    }
+
+    // World-space geometric normal at a hit, following the triangle's winding (not normalized).
+    [[nodiscard]] glm::vec3
+    normal(const InstanceHit &hit) const {
+        return hit.instance == Hit::invalid ? triangleNormal(mesh, hit.prim) : tlas->normal(hit);
+    }
+
+    [[nodiscard]] uint32_t
+    materialIndex(const InstanceHit &hit) const {
+        return hit.instance == Hit::invalid ? triangleMaterials[hit.prim]
+                                            : tlas->instances()[hit.instance].material;
+    }
+
+    [[nodiscard]] const Material &
+    materialOf(const InstanceHit &hit) const {
+        return materials[materialIndex(hit)];
+    }
+
+    [[nodiscard]] const Material &
+    materialOf(uint32_t prim) const {
+        return materials[triangleMaterials[prim]];
+    }
+};
+
+struct Scene {
+    Mesh                  mesh;
+    std::vector<Material> materials;
+    std::vector<uint32_t> triangleMaterials;
+    std::vector<uint32_t> lights;
+    Camera                camera;
+    BVH                   bvh;
+    NativeBVH             wideBvh;
+
+    // Adds a mesh using a single material and returns the index of its first triangle.
+    uint32_t
+    add(const Mesh &part, const Material &material);
+
+    // Rebuilds both BVHs and the light list. Must be called after the geometry changes.
+    void
+    commit(const BVHBuildOptions &options = {});
+
+    // Rebuilds only the light list, for callers that build the BVHs themselves.
+    void
+    findLights();
+
+    // Brings both BVHs up to date after vertices moved, which is much cheaper than commit().
+    // Only valid while the triangles and materials are the ones of the last commit().
+    BVHUpdate
+    update(const BVHBuildOptions &options = {});
+
+    [[nodiscard]] SceneView
+    view() const {
+        return {mesh.view(), bvh.view(), materials, triangleMaterials, lights, camera, &wideBvh};
+    }
+};
+
+} // namespace glpt
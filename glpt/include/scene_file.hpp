@@ -0,0 +1,105 @@
+//
+// Created by taylor-santos on 10/16/2026 at 19:35.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "camera.hpp"
+#include "mapped_file.hpp"
+#include "scene.hpp"
+
+namespace glpt {
+
+// On-disk layout of a .glpt scene file (little-endian):
+//
+//   SceneFileHeader
+//   one array per SceneSection, each starting at a 64-byte aligned offset
+//
+// Arrays hold the exact in-memory representation of the corresponding SceneView spans, so a
+// loaded scene points straight into the mapping. Any change to the header, to the section list
+// or to the layout of a stored struct must bump SceneFileHeader::currentVersion.
+enum class SceneSection : uint32_t {
+    Positions,
+    Triangles,
+    Materials,
+    TriangleMaterials,
+    Lights,
+    BVHNodes,
+    PrimIndices,
+    Count
+};
+
+struct SceneFileSection {
+    uint64_t offset; // In bytes from the start of the file.
+    uint64_t count;  // In elements.
+};
+
+struct SceneFileHeader {
+    static constexpr char     magicValue[8]  = {'G', 'L', 'P', 'T', 'S', 'C', 'N', '\0'};
+    static constexpr uint32_t currentVersion = 1;
+    // Written as a native uint32_t; reads back differently on a machine of the other endianness.
+    static constexpr uint32_t endianTag = 0x01020304u;
+    static constexpr uint64_t alignment = 64;
+
+    char             magic[8];
+    uint32_t         version;
+    uint32_t         endian;
+    SceneFileSection sections[static_cast<std::size_t>(SceneSection::Count)];
+    Camera           camera;
+};
+
+// Writes the scene, including its binary BVH, to path. Instances in scene.tlas are not saved.
+// Returns false on I/O failure.
+bool
+writeSceneFile(const SceneView &scene, const std::string &path);
+
+struct SceneFileOptions {
+    // Run verify() while opening. Without it, opening only validates the header and section
+    // bounds and takes the same time for any scene size, but an invalid index in the file makes
+    // rendering read out of bounds. Only turn it off for files this program wrote itself.
+    bool verify = true;
+    // Build a wide BVH from the stored binary one and attach it to view(). Traversal is faster,
+    // but opening then takes time proportional to the scene size.
+    bool buildWideBvh = false;
+};
+
+// A scene file mapped into memory. The data is paged in as it is first touched.
+class SceneFile {
+public:
+    // Throws std::runtime_error if the file can't be mapped or fails validation.
+    explicit SceneFile(const std::string &path, const SceneFileOptions &options = {});
+
+    // view() may point at the wide BVH inside this object.
+    SceneFile(const SceneFile &) = delete;
+    SceneFile &
+    operator=(const SceneFile &) = delete;
+
+    [[nodiscard]] const SceneFileHeader &
+    header() const {
+        return header_;
+    }
+
+    // Views into the mapping, valid for the lifetime of this object. The wide BVH is only
+    // attached if it was requested in the options.
+    [[nodiscard]] const SceneView &
+    view() const {
+        return view_;
+    }
+
+    // Checks every index in the file against the array it refers to, and that the BVH is a tree
+    // in depth-first order, reaching every node once, no deeper than BVHView::maxDepth. This
+    // reads the whole file. Throws std::runtime_error.
+    void
+    verify() const;
+
+private:
+    MappedFile      file_;
+    SceneFileHeader header_{};
+    SceneView       view_;
+    NativeBVH       wideBvh_;
+};
+
+} // namespace glpt
@@ -0,0 +1,237 @@
+//
+// Created by taylor-santos on 10/16/2026 at 17:05.
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Instruction sets are picked up from the compiler's target flags, never forced, so the default
+// build runs on any machine. GLPT_DISABLE_SIMD selects the portable loops for every width.
+#if !defined(GLPT_DISABLE_SIMD)
+#    if defined(__AVX2__)
+#        define GLPT_SIMD_AVX2 1
+#    endif
+#    if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#        define GLPT_SIMD_SSE 1
+#    endif
+#endif
+
+#if defined(GLPT_SIMD_SSE) || defined(GLPT_SIMD_AVX2)
+#    include <immintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#    include <intrin.h>
+#endif
+
+namespace glpt::simd {
+
+// Widest packet the target supports natively.
+#if defined(GLPT_SIMD_AVX2)
+constexpr int nativeWidth = 8;
+#else
+constexpr int nativeWidth = 4;
+#endif
+
+// W floats processed in lockstep. The primary templates are plain loops that work for any
+// width; widths with a native register get specializations below.
+template<int W>
+struct Float {
+    std::array<float, W> lanes;
+};
+
+// Per-lane result of a comparison.
+template<int W>
+struct Mask {
+    std::array<bool, W> lanes;
+};
+
+template<int W>
+Float<W>
+splat(float x) {
+    Float<W> r;
+    r.lanes.fill(x);
+    return r;
+}
+
+template<int W>
+Float<W>
+load(const float *p) {
+    Float<W> r;
+    for (int i = 0; i < W; i++) r.lanes[i] = p[i];
+    return r;
+}
+
+template<int W>
+void
+store(const Float<W> &a, float *p) {
+    for (int i = 0; i < W; i++) p[i] = a.lanes[i];
+}
+
+#define GLPT_SIMD_GENERIC_OP(NAME, RESULT, EXPR)                                                   \
+    template<int W>                                                                                \
+    RESULT<W> NAME(const Float<W> &a, const Float<W> &b) {                                         \
+        RESULT<W> r;                                                                               \
+        for (int i = 0; i < W; i++) r.lanes[i] = EXPR;                                             \
+        return r;                                                                                  \
+    }
+
+GLPT_SIMD_GENERIC_OP(operator+, Float, a.lanes[i] + b.lanes[i])
+GLPT_SIMD_GENERIC_OP(operator-, Float, a.lanes[i] - b.lanes[i])
+GLPT_SIMD_GENERIC_OP(operator*, Float, a.lanes[i] * b.lanes[i])
+GLPT_SIMD_GENERIC_OP(operator/, Float, a.lanes[i] / b.lanes[i])
+GLPT_SIMD_GENERIC_OP(min, Float, b.lanes[i] < a.lanes[i] ? b.lanes[i] : a.lanes[i])
+GLPT_SIMD_GENERIC_OP(max, Float, a.lanes[i] < b.lanes[i] ? b.lanes[i] : a.lanes[i])
+GLPT_SIMD_GENERIC_OP(operator<, Mask, a.lanes[i] < b.lanes[i])
+GLPT_SIMD_GENERIC_OP(operator<=, Mask, a.lanes[i] <= b.lanes[i])
+GLPT_SIMD_GENERIC_OP(operator>, Mask, a.lanes[i] > b.lanes[i])
+GLPT_SIMD_GENERIC_OP(operator>=, Mask, a.lanes[i] >= b.lanes[i])
+
+#undef GLPT_SIMD_GENERIC_OP
+
+template<int W>
+Mask<W>
+operator&(const Mask<W> &a, const Mask<W> &b) {
+    Mask<W> r;
+    for (int i = 0; i < W; i++) r.lanes[i] = a.lanes[i] && b.lanes[i];
+    return r;
+}
+
+template<int W>
+Mask<W>
+operator|(const Mask<W> &a, const Mask<W> &b) {
+    Mask<W> r;
+    for (int i = 0; i < W; i++) r.lanes[i] = a.lanes[i] || b.lanes[i];
+    return r;
+}
+
+// Bit i is set if lane i is set.
+template<int W>
+uint32_t
+bits(const Mask<W> &m) {
+    uint32_t r = 0;
+    for (int i = 0; i < W; i++) r |= static_cast<uint32_t>(m.lanes[i]) << i;
+    return r;
+}
+
+// Index of the lowest set bit of a nonzero mask from bits(). Same as std::countr_zero, which the
+// older standard libraries in CI don't have.
+inline uint32_t
+lowestLane(uint32_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+}
+
+#if defined(GLPT_SIMD_SSE)
+
+template<>
+struct Float<4> {
+    __m128 v;
+};
+
+template<>
+struct Mask<4> {
+    __m128 v;
+};
+
+template<>
+inline Float<4>
+splat<4>(float x) {
+    return {_mm_set1_ps(x)};
+}
+
+template<>
+inline Float<4>
+load<4>(const float *p) {
+    return {_mm_loadu_ps(p)};
+}
+
+template<>
+inline void
+store<4>(const Float<4> &a, float *p) {
+    _mm_storeu_ps(p, a.v);
+}
+
+// clang-format off
+inline Float<4> operator+(const Float<4> &a, const Float<4> &b) { return {_mm_add_ps(a.v, b.v)}; }
+inline Float<4> operator-(const Float<4> &a, const Float<4> &b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline Float<4> operator*(const Float<4> &a, const Float<4> &b) { return {_mm_mul_ps(a.v, b.v)}; }
+inline Float<4> operator/(const Float<4> &a, const Float<4> &b) { return {_mm_div_ps(a.v, b.v)}; }
+inline Float<4> min(const Float<4> &a, const Float<4> &b) { return {_mm_min_ps(b.v, a.v)}; }
+inline Float<4> max(const Float<4> &a, const Float<4> &b) { return {_mm_max_ps(b.v, a.v)}; }
+inline Mask<4> operator<(const Float<4> &a, const Float<4> &b) { return {_mm_cmplt_ps(a.v, b.v)}; }
+inline Mask<4> operator<=(const Float<4> &a, const Float<4> &b) { return {_mm_cmple_ps(a.v, b.v)}; }
+inline Mask<4> operator>(const Float<4> &a, const Float<4> &b) { return {_mm_cmpgt_ps(a.v, b.v)}; }
+inline Mask<4> operator>=(const Float<4> &a, const Float<4> &b) { return {_mm_cmpge_ps(a.v, b.v)}; }
+inline Mask<4> operator&(const Mask<4> &a, const Mask<4> &b) { return {_mm_and_ps(a.v, b.v)}; }
+inline Mask<4> operator|(const Mask<4> &a, const Mask<4> &b) { return {_mm_or_ps(a.v, b.v)}; }
+// clang-format on
+
+template<>
+inline uint32_t
+bits<4>(const Mask<4> &m) {
+    return static_cast<uint32_t>(_mm_movemask_ps(m.v));
+}
+
+#endif // GLPT_SIMD_SSE
+
+#if defined(GLPT_SIMD_AVX2)
+
+template<>
+struct Float<8> {
+    __m256 v;
+};
+
+template<>
+struct Mask<8> {
+    __m256 v;
+};
+
+template<>
+inline Float<8>
+splat<8>(float x) {
+    return {_mm256_set1_ps(x)};
+}
+
+template<>
+inline Float<8>
+load<8>(const float *p) {
+    return {_mm256_loadu_ps(p)};
+}
+
+template<>
+inline void
+store<8>(const Float<8> &a, float *p) {
+    _mm256_storeu_ps(p, a.v);
+}
+
+// clang-format off
+inline Float<8> operator+(const Float<8> &a, const Float<8> &b) { return {_mm256_add_ps(a.v, b.v)}; }
+inline Float<8> operator-(const Float<8> &a, const Float<8> &b) { return {_mm256_sub_ps(a.v, b.v)}; }
+inline Float<8> operator*(const Float<8> &a, const Float<8> &b) { return {_mm256_mul_ps(a.v, b.v)}; }
+inline Float<8> operator/(const Float<8> &a, const Float<8> &b) { return {_mm256_div_ps(a.v, b.v)}; }
+inline Float<8> min(const Float<8> &a, const Float<8> &b) { return {_mm256_min_ps(b.v, a.v)}; }
+inline Float<8> max(const Float<8> &a, const Float<8> &b) { return {_mm256_max_ps(b.v, a.v)}; }
+inline Mask<8> operator<(const Float<8> &a, const Float<8> &b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)}; }
+inline Mask<8> operator<=(const Float<8> &a, const Float<8> &b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ)}; }
+inline Mask<8> operator>(const Float<8> &a, const Float<8> &b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)}; }
+inline Mask<8> operator>=(const Float<8> &a, const Float<8> &b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ)}; }
+inline Mask<8> operator&(const Mask<8> &a, const Mask<8> &b) { return {_mm256_and_ps(a.v, b.v)}; }
+inline Mask<8> operator|(const Mask<8> &a, const Mask<8> &b) { return {_mm256_or_ps(a.v, b.v)}; }
+// clang-format on
+
+template<>
+inline uint32_t
+bits<8>(const Mask<8> &m) {
+    return static_cast<uint32_t>(_mm256_movemask_ps(m.v));
+}
+
+#endif // GLPT_SIMD_AVX2
+
+} // namespace glpt::simd
@@ -0,0 +1,139 @@
+//
+// Created by taylor-santos on 10/16/2026 at 23:10.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<span>)
+#    include <span>
+#endif
+
+// glpt::span is std::span where the standard library has it. Older ones, such as libstdc++
+// before GCC 10 or libstdc++ 10 with a Clang that lacks concepts, get a minimal replacement with
+// the subset of the std::span interface that glpt uses: dynamic extent only.
+
+#if defined(__cpp_lib_span)
+
+namespace glpt {
+
+using std::as_bytes;
+using std::span;
+
+} // namespace glpt
+
+#else
+
+namespace glpt {
+
+template<typename T>
+class span {
+public:
+    using element_type = T;
+    using value_type   = std::remove_cv_t<T>;
+    using size_type    = std::size_t;
+    using pointer      = T *;
+    using reference    = T &;
+    using iterator     = T *;
+
+    constexpr span() noexcept = default;
+
+    constexpr span(T *data, std::size_t size) noexcept
+        : data_{data}
+        , size_{size} {}
+
+    template<std::size_t N>
+    constexpr span(T (&array)[N]) noexcept
+        : data_{array}
+        , size_{N} {}
+
+    // Any contiguous container whose elements convert to T without slicing, e.g. a std::vector,
+    // std::array or another span.
+    template<
+        typename Container,
+        typename = std::enable_if_t<
+            !std::is_same_v<std::remove_cv_t<std::remove_reference_t<Container>>, span> &&
+            std::is_convertible_v<
+                std::remove_pointer_t<decltype(std::declval<Container &>().data())> (*)[],
+                T (*)[]>>>
+    constexpr span(Container &&container) noexcept
+        : data_{container.data()}
+        , size_{container.size()} {}
+
+    [[nodiscard]] constexpr T *
+    data() const noexcept {
+        return data_;
+    }
+
+    [[nodiscard]] constexpr std::size_t
+    size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] constexpr std::size_t
+    size_bytes() const noexcept {
+        return size_ * sizeof(T);
+    }
+
+    [[nodiscard]] constexpr bool
+    empty() const noexcept {
+        return size_ == 0;
+    }
+
+    constexpr T &
+    operator[](std::size_t index) const noexcept {
+        return data_[index];
+    }
+
+    [[nodiscard]] constexpr T &
+    front() const noexcept {
+        return data_[0];
+    }
+
+    [[nodiscard]] constexpr T &
+    back() const noexcept {
+        return data_[size_ - 1];
+    }
+
+    [[nodiscard]] constexpr T *
+    begin() const noexcept {
+        return data_;
+    }
+
+    [[nodiscard]] constexpr T *
+    end() const noexcept {
+        return data_ + size_;
+    }
+
+    [[nodiscard]] constexpr span
+    first(std::size_t count) const noexcept {
+        return {data_, count};
+    }
+
+    [[nodiscard]] constexpr span
+    subspan(std::size_t offset) const noexcept {
+        return {data_ + offset, size_ - offset};
+    }
+
+    [[nodiscard]] constexpr span
+    subspan(std::size_t offset, std::size_t count) const noexcept {
+        return {data_ + offset, count};
+    }
+
+private:
+    T          *data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+template<typename T>
+span<const std::byte>
+as_bytes(span<T> s) noexcept {
+    return {reinterpret_cast<const std::byte *>(s.data()), s.size_bytes()};
+}
+
+} // namespace glpt
+
+#endif
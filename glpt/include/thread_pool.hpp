@@ -0,0 +1,99 @@
+//
+// Created by taylor-santos on 10/16/2026 at 13:05.
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace glpt {
+
+// Persistent pool of worker threads for data-parallel loops over a fixed number of tasks.
+//
+// Each call to parallelFor splits [0, count) into one contiguous range per worker. A worker
+// consumes its own range from the front, which keeps neighbouring tiles on the same core, and
+// once it runs dry it steals single tasks from the back of the other workers' ranges. Ranges are
+// packed into one atomic word each, so scheduling never takes a lock or allocates.
+class ThreadPool {
+public:
+    // 0 selects std::thread::hardware_concurrency(). The calling thread counts as one worker.
+    explicit ThreadPool(unsigned threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &
+    operator=(const ThreadPool &) = delete;
+
+    [[nodiscard]] unsigned
+    size() const {
+        return workerCount_;
+    }
+
+    // Calls fn(task, worker) exactly once for every task in [0, count) and returns when all of
+    // them have finished. worker is in [0, size()) and is unique among concurrently running calls,
+    // so it can index per-thread scratch data. fn must not throw.
+    template<typename Fn>
+    void
+    parallelFor(uint32_t count, Fn &&fn) {
+        using F = std::remove_cv_t<std::remove_reference_t<Fn>>;
+        run(
+            count,
+            [](void *ctx, uint32_t task, unsigned worker) {
+                (*static_cast<F *>(ctx))(task, worker);
+            },
+            const_cast<F *>(&fn));
+    }
+
+private:
+    using TaskFn = void (*)(void *ctx, uint32_t task, unsigned worker);
+
+    // Remaining task range of one worker, packed as (begin << 32) | end. Padded to a cache line
+    // so that workers taking tasks from their own range don't contend with each other. The
+    // padding is explicit because MSVC warns (C4324) when alignas has to add it.
+    struct alignas(64) Queue {
+        std::atomic<uint64_t> range{0};
+        char                  padding[64 - sizeof(std::atomic<uint64_t>)];
+    };
+
+    unsigned                 workerCount_;
+    std::unique_ptr<Queue[]> queues_;
+    std::vector<std::thread> threads_;
+
+    std::mutex              mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    uint64_t                generation_ = 0;
+    unsigned                busy_       = 0;
+    bool                    stop_       = false;
+
+    TaskFn fn_  = nullptr;
+    void  *ctx_ = nullptr;
+
+    void
+    run(uint32_t count, TaskFn fn, void *ctx);
+
+    void
+    workerLoop(unsigned worker);
+
+    void
+    drain(unsigned worker);
+
+    // Called by each worker once it runs out of tasks.
+    void
+    finish(unsigned worker, uint64_t generation);
+
+    bool
+    popFront(unsigned worker, uint32_t &task);
+
+    bool
+    stealBack(unsigned victim, uint32_t &task);
+};
+
+} // namespace glpt
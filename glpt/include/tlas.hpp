@@ -0,0 +1,110 @@
+//
+// Created by taylor-santos on 10/16/2026 at 23:48.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "aabb.hpp"
+#include "bvh.hpp"
+#include "mesh.hpp"
+#include "ray.hpp"
+#include "span.hpp"
+
+namespace glpt {
+
+// Bottom-level acceleration structure: a mesh in its own object space and a BVH over it.
+struct BLASView {
+    MeshView mesh;
+    BVHView  bvh;
+};
+
+// One placement of a BLAS in the world.
+struct Instance {
+    uint32_t  blas = 0;
+    glm::mat4 transform{1.0f}; // Object to world.
+    // Material of every triangle of the instance, as an index into SceneView::materials.
+    uint32_t  material = 0;
+};
+
+// A hit in a TLAS. prim indexes the triangles of the instance's BLAS.
+struct InstanceHit : Hit {
+    uint32_t instance = invalid;
+};
+
+// Top-level acceleration structure: a BVH over instances of BLASes. Rays are moved into the
+// object space of each instance they reach, so moving an instance only changes the top level,
+// and the geometry and BVH of a BLAS are shared by all of its instances.
+class TLAS {
+public:
+    TLAS() = default;
+
+    // The BLASes are referenced, not copied, and must outlive the TLAS.
+    static TLAS
+    build(
+        std::vector<BLASView>  blases,
+        std::vector<Instance>  instances,
+        const BVHBuildOptions &options = {});
+
+    [[nodiscard]] span<const BLASView>
+    blases() const {
+        return blases_;
+    }
+
+    [[nodiscard]] span<const Instance>
+    instances() const {
+        return instances_;
+    }
+
+    [[nodiscard]] const BVH &
+    bvh() const {
+        return bvh_;
+    }
+
+    // Moves an instance. Takes effect at the next update().
+    void
+    setTransform(uint32_t instance, const glm::mat4 &transform);
+
+    // Points a BLAS at new data, e.g. after its BVH was refit or rebuilt. Takes effect at the
+    // next update().
+    void
+    setBLAS(uint32_t blas, const BLASView &view);
+
+    // Refits the top level to the current transforms and BLAS bounds, rebuilding it only once
+    // its SAH cost has degraded past the build options' rebuildThreshold. No BLAS is touched.
+    BVHUpdate
+    update();
+
+    // Same contract as BVHView::intersect.
+    bool
+    intersect(const Ray &ray, InstanceHit &hit) const;
+
+    // Same contract as BVHView::occluded.
+    [[nodiscard]] bool
+    occluded(const Ray &ray) const;
+
+    // World-space geometric normal at a hit, following the triangle's winding (not normalized).
+    [[nodiscard]] glm::vec3
+    normal(const InstanceHit &hit) const;
+
+private:
+    std::vector<BLASView>  blases_;
+    std::vector<Instance>  instances_;
+    std::vector<glm::mat4> worldToObject_;
+    std::vector<AABB>      instanceBounds_;
+    BVH                    bvh_;
+    BVHBuildOptions        options_;
+
+    void
+    computeBounds();
+
+    template<bool AnyHit>
+    bool
+    traverse(const Ray &ray, float tMax, InstanceHit &hit) const;
+};
+
+} // namespace glpt
@@ -0,0 +1,119 @@
+//
+// Created by taylor-santos on 10/16/2026 at 19:10.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+#include "arena.hpp"
+#include "image.hpp"
+#include "random.hpp"
+#include "renderer.hpp"
+#include "scene.hpp"
+#include "span.hpp"
+#include "thread_pool.hpp"
+
+namespace glpt {
+
+struct WavefrontOptions {
+    // Paths in flight per wave, rounded down to whole pixels. Bounds the size of the queues.
+    uint32_t batchSize = 64 * 1024;
+    // Reorder the queues between stages: hits by material before shading and continuation rays
+    // by direction before the next extension.
+    bool sortQueues = true;
+};
+
+// Wavefront path tracer. Instead of following each path to completion, a batch of paths is
+// advanced one bounce at a time through separate stages:
+//
+//   generate  camera rays for every path of the batch
+//   extend    closest hit for every active path
+//   shade     emission, next-event sample and continuation ray at every hit
+//   connect   shadow rays for the light samples made while shading
+//
+// Path state lives in structure-of-arrays buffers indexed by path, and each stage works off a
+// queue of path indices, so a stage touches only the fields it needs and sorted queues give the
+// BVH traversal coherent batches of rays.
+//
+// Each path consumes its random numbers in the same order as tracePath and does the same
+// arithmetic, so the image is bit-identical to render() with the same settings.
+//
+// The buffers are kept between frames; a renderer must not be used by two threads at once.
+class WavefrontRenderer {
+public:
+    explicit WavefrontRenderer(const WavefrontOptions &options = {});
+
+    Image
+    render(const SceneView &scene, const RenderSettings &settings, ThreadPool &pool);
+
+    // Renders into image, reusing its storage if it already has the right size. Once a frame of
+    // the same size has been rendered this does not allocate.
+    void
+    render(
+        const SceneView      &scene,
+        const RenderSettings &settings,
+        ThreadPool           &pool,
+        Image                &image);
+
+private:
+    WavefrontOptions options_;
+
+    // Per frame storage for everything below, so steady-state frames don't allocate.
+    Arena arena_;
+
+    // Per path state.
+    span<glm::vec3> origin_;
+    span<glm::vec3> direction_;
+    span<glm::vec3> throughput_;
+    span<glm::vec3> radiance_;
+    span<Pcg32>     rng_;
+    span<float>     hitT_;
+    span<uint32_t>  hitPrim_;
+    span<uint32_t>  hitInstance_;
+    span<uint8_t>   alive_;
+    // Pending light sample, valid when shadowWeight_ is nonzero.
+    span<glm::vec3> shadowDirection_;
+    span<float>     shadowDistance_;
+    span<glm::vec3> shadowWeight_;
+
+    // Queues of path indices and the scratch used to sort them.
+    span<uint32_t> active_;
+    span<uint32_t> shadow_;
+    span<uint32_t> scratch_;
+    span<uint32_t> buckets_;
+
+    void
+    allocate(uint32_t paths, uint32_t bucketCount);
+
+    void
+    generate(
+        const SceneView      &scene,
+        const RenderSettings &settings,
+        ThreadPool           &pool,
+        uint32_t              firstPixel,
+        uint32_t              paths);
+
+    void
+    extend(const SceneView &scene, ThreadPool &pool, uint32_t count);
+
+    void
+    shade(
+        const SceneView          &scene,
+        const IntegratorSettings &settings,
+        ThreadPool               &pool,
+        uint32_t                  count,
+        uint32_t                  bounce);
+
+    void
+    connect(const SceneView &scene, ThreadPool &pool, uint32_t count);
+
+    // Stable counting sort of the first count entries of queue by key(path) < bucketCount.
+    template<typename Key>
+    void
+    sortQueue(span<uint32_t> queue, uint32_t count, uint32_t bucketCount, Key key);
+};
+
+} // namespace glpt
@@ -0,0 +1,112 @@
+//
+// Created by taylor-santos on 10/16/2026 at 17:40.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "bvh.hpp"
+#include "mesh.hpp"
+#include "ray.hpp"
+#include "simd.hpp"
+#include "span.hpp"
+
+namespace glpt {
+
+// Interior node of a W-wide BVH with the children's bounds stored as structure of arrays, so
+// one ray can be tested against all W boxes with a single pass of vector instructions.
+template<int W>
+struct alignas(4 * W) WideNode {
+    static constexpr uint32_t leafFlag   = 0x80000000u;
+    static constexpr uint32_t emptyChild = ~uint32_t{0};
+
+    float minX[W];
+    float minY[W];
+    float minZ[W];
+    float maxX[W];
+    float maxY[W];
+    float maxZ[W];
+    // Interior child: node index. Leaf child: leafFlag | index of its first triangle packet.
+    uint32_t child[W];
+    // Number of triangle packets of a leaf child.
+    uint32_t packetCount[W];
+};
+
+// W triangles in the precomputed form Möller–Trumbore needs, as structure of arrays. Unused
+// lanes hold degenerate triangles that can never be hit.
+template<int W>
+struct alignas(4 * W) TrianglePacket {
+    float    v0[3][W];
+    float    e1[3][W];
+    float    e2[3][W];
+    uint32_t prim[W];
+};
+
+// W-wide BVH collapsed from a binary one. Triangles are copied into packets, so traversal does
+// not need the mesh. Any W works; widths the target has registers for run with intrinsics and
+// the rest use the portable loops in simd.hpp.
+template<int W>
+class WideBVH {
+public:
+    static_assert(W >= 2 && W <= 32, "WideBVH width must fit in a 32-bit lane mask");
+
+    WideBVH() = default;
+
+    static WideBVH
+    build(const BVHView &bvh, const MeshView &mesh);
+
+    // Reloads every triangle from the mesh and recomputes the bounds bottom-up, keeping the
+    // tree. Same contract as BVH::refit.
+    void
+    refit(const MeshView &mesh);
+
+    [[nodiscard]] bool
+    empty() const {
+        return nodes_.empty();
+    }
+
+    [[nodiscard]] span<const WideNode<W>>
+    nodes() const {
+        return nodes_;
+    }
+
+    [[nodiscard]] span<const TrianglePacket<W>>
+    packets() const {
+        return packets_;
+    }
+
+    // Same contract as BVHView::intersect.
+    bool
+    intersect(const Ray &ray, Hit &hit) const;
+
+    // Same contract as BVHView::occluded.
+    [[nodiscard]] bool
+    occluded(const Ray &ray) const;
+
+private:
+    std::vector<WideNode<W>>       nodes_;
+    std::vector<TrianglePacket<W>> packets_;
+
+    uint32_t
+    collapse(const BVHView &bvh, const MeshView &mesh, uint32_t binaryNode);
+
+    uint32_t
+    addPackets(const BVHView &bvh, const MeshView &mesh, const BVHNode &leaf);
+
+    static void
+    loadTriangle(TrianglePacket<W> &packet, uint32_t lane, const MeshView &mesh, uint32_t prim);
+
+    template<bool AnyHit>
+    bool
+    traverse(const Ray &ray, float tMax, Hit &hit) const;
+};
+
+extern template class WideBVH<4>;
+extern template class WideBVH<8>;
+
+// Width used by the renderers.
+using NativeBVH = WideBVH<simd::nativeWidth>;
+
+} // namespace glpt
@@ -0,0 +1,52 @@
+//
+// Created by taylor-santos on 10/16/2026 at 20:59.
+//
+
+#include "arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace glpt {
+
+Arena::Arena(std::size_t blockSize)
+    : blockSize_{std::max<std::size_t>(blockSize, 64)} {}
+
+void *
+Arena::allocate(std::size_t bytes, std::size_t alignment) {
+    for (; current_ < blocks_.size(); current_++, offset_ = 0) {
+        Block      &block   = blocks_[current_];
+        auto        base    = reinterpret_cast<std::uintptr_t>(block.data.get());
+        std::size_t aligned = (base + offset_ + alignment - 1) / alignment * alignment - base;
+        if (aligned + bytes <= block.size) {
+            offset_ = aligned + bytes;
+            return block.data.get() + aligned;
+        }
+    }
+    // new[] only guarantees fundamental alignment, so leave room to align by hand.
+    std::size_t size = std::max(blockSize_, bytes + alignment);
+    blocks_.push_back({std::unique_ptr<std::byte[]>(new std::byte[size]), size});
+    return allocate(bytes, alignment);
+}
+
+void
+Arena::reset() {
+    if (blocks_.size() > 1) {
+        std::size_t total = capacity();
+        blocks_.clear();
+        blocks_.push_back({std::unique_ptr<std::byte[]>(new std::byte[total]), total});
+    }
+    current_ = 0;
+    offset_  = 0;
+}
+
+std::size_t
+Arena::capacity() const {
+    std::size_t total = 0;
+    for (const Block &block : blocks_) {
+        total += block.size;
+    }
+    return total;
+}
+
+} // namespace glpt
@@ -0,0 +1,472 @@
+//
+// Created by taylor-santos on 10/16/2026 at 10:05.
+//
+
+#include "bvh.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "arena.hpp"
+#include "profiler.hpp"
+
+namespace glpt {
+
+namespace {
+
+// Children are indices into the builder's node pool. Interior nodes have count == 0.
+struct BuildNode {
+    AABB     bounds;
+    uint32_t first = 0;
+    uint32_t count = 0;
+    uint32_t left  = 0;
+    uint32_t right = 0;
+};
+
+struct Bin {
+    AABB     bounds;
+    AABB     centroids;
+    uint32_t count = 0;
+};
+
+struct Split {
+    int      axis  = -1;
+    uint32_t bin   = 0;
+    float    cost  = std::numeric_limits<float>::infinity();
+    Bin      left  = {};
+    Bin      right = {};
+};
+
+// Runs fn(begin, end) over threadCount contiguous chunks of [0, count) and waits for all of them.
+template<typename Fn>
+void
+parallelChunks(std::size_t count, unsigned threadCount, Fn &&fn) {
+    if (threadCount <= 1 || count < 2) {
+        fn(std::size_t{0}, count);
+        return;
+    }
+    std::vector<std::future<void>> tasks;
+    tasks.reserve(threadCount - 1);
+    std::size_t chunk = (count + threadCount - 1) / threadCount;
+    for (std::size_t begin = chunk; begin < count; begin += chunk) {
+        std::size_t end = std::min(begin + chunk, count);
+        tasks.push_back(std::async(std::launch::async, [&fn, begin, end] { fn(begin, end); }));
+    }
+    fn(std::size_t{0}, std::min(chunk, count));
+    for (auto &task : tasks) {
+        task.get();
+    }
+}
+
+class Builder {
+public:
+    // boundsOf(i) returns the bounds of primitive i.
+    template<typename BoundsFn>
+    Builder(
+        std::size_t            count,
+        BoundsFn             &&boundsOf,
+        const BVHBuildOptions &options,
+        std::vector<uint32_t> &indices)
+        : options_{options}
+        , indices_{indices}
+        , maxThreads_{options.threadCount}
+        , primBounds_(count)
+        , centroids_(count)
+        // A binary tree with at most one leaf per primitive never needs more nodes than this, so
+        // the pool is allocated once and nodes are taken from it with an atomic increment.
+        , nodes_(std::max<std::size_t>(2 * count, 2) - 1) {
+        if (maxThreads_ == 0) maxThreads_ = std::max(1u, std::thread::hardware_concurrency());
+        while ((1u << spawnDepth_) < maxThreads_) spawnDepth_++;
+        options_.binCount    = std::clamp(options_.binCount, 2u, 256u);
+        options_.maxLeafSize = std::max(options_.maxLeafSize, 1u);
+        unsigned threads     = count >= options_.parallelThreshold ? maxThreads_ : 1;
+        parallelChunks(count, threads, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                primBounds_[i] = boundsOf(i);
+                centroids_[i]  = primBounds_[i].center();
+            }
+        });
+    }
+
+    // Builds the tree and returns the index of its root in nodes().
+    uint32_t
+    buildRoot() {
+        return build(0, gather(0, static_cast<uint32_t>(indices_.size())), 0);
+    }
+
+    [[nodiscard]] const std::vector<BuildNode> &
+    nodes() const {
+        return nodes_;
+    }
+
+    [[nodiscard]] uint32_t
+    nodeCount() const {
+        return nodeCount_.load(std::memory_order_relaxed);
+    }
+
+private:
+    BVHBuildOptions        options_;
+    std::vector<uint32_t> &indices_;
+    unsigned               maxThreads_;
+    // Only nodes above this depth fork: ceil(log2(maxThreads_)) levels of forking keep every core
+    // busy, and bounding them bounds the number of threads a build ever starts.
+    uint32_t               spawnDepth_ = 0;
+    std::atomic<uint32_t>  nodeCount_{0};
+    std::vector<AABB>      primBounds_;
+    std::vector<glm::vec3> centroids_;
+    std::vector<BuildNode> nodes_;
+
+    Bin
+    gather(uint32_t first, uint32_t count) const {
+        Bin bin;
+        for (uint32_t i = first; i < first + count; i++) {
+            bin.bounds.grow(primBounds_[indices_[i]]);
+            bin.centroids.grow(centroids_[indices_[i]]);
+        }
+        bin.count = count;
+        return bin;
+    }
+
+    // Threads to bin a node with. The 2^depth nodes of a level share the cores between them.
+    [[nodiscard]] unsigned
+    threadsFor(uint32_t count, uint32_t depth) const {
+        if (count < options_.parallelThreshold || depth >= spawnDepth_) return 1;
+        return std::max(1u, maxThreads_ >> depth);
+    }
+
+    // Scale from centroid offset to bin along the axis, or 0 if the centroids are too close
+    // together to bin: below this extent the scale would be infinite and bin indices undefined.
+    [[nodiscard]] float
+    binScale(const AABB &centroidBounds, int axis) const {
+        auto  binCount = static_cast<float>(options_.binCount);
+        float extent   = centroidBounds.extent()[axis];
+        if (!(extent > std::numeric_limits<float>::min() * binCount)) return 0.0f;
+        return binCount / extent;
+    }
+
+    Split
+    findSplit(
+        uint32_t    first,
+        uint32_t    count,
+        uint32_t    depth,
+        const AABB &bounds,
+        const AABB &centroidBounds) const {
+        const uint32_t binCount = options_.binCount;
+        glm::vec3      scale{0.0f};
+        for (int axis = 0; axis < 3; axis++) {
+            scale[axis] = binScale(centroidBounds, axis);
+        }
+
+        // Bins live in a scratch arena owned by the calling thread, which is rewound on every
+        // call, so splitting a node doesn't touch the heap once the arena has grown.
+        thread_local Arena scratch;
+        scratch.reset();
+        unsigned  threads = threadsFor(count, depth);
+        span<Bin> partial = scratch.allocate<Bin>(std::size_t{threads} * 3 * binCount);
+        span<Bin> suffix  = scratch.allocate<Bin>(binCount);
+
+        // Bin every centroid along all three axes at once, splitting large ranges across threads.
+        std::atomic<unsigned> nextChunk{0};
+        parallelChunks(count, threads, [&](std::size_t begin, std::size_t end) {
+            unsigned chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+            Bin     *bins  = &partial[std::size_t{chunk} * 3 * binCount];
+            for (std::size_t i = first + begin; i < first + end; i++) {
+                uint32_t         prim     = indices_[i];
+                const glm::vec3 &centroid = centroids_[prim];
+                for (int axis = 0; axis < 3; axis++) {
+                    uint32_t b   = binIndex(centroid, centroidBounds, scale, axis);
+                    Bin     &bin = bins[static_cast<uint32_t>(axis) * binCount + b];
+                    bin.bounds.grow(primBounds_[prim]);
+                    bin.centroids.grow(centroid);
+                    bin.count++;
+                }
+            }
+        });
+        // Fold the other chunks into the first one.
+        span<Bin> bins = partial.first(std::size_t{3} * binCount);
+        for (unsigned t = 1; t < threads; t++) {
+            for (uint32_t b = 0; b < 3 * binCount; b++) {
+                merge(bins[b], partial[std::size_t{t} * 3 * binCount + b]);
+            }
+        }
+
+        // Sweep from the right to accumulate suffix bins, then from the left to evaluate every
+        // candidate plane.
+        Split best;
+        float invArea = 1.0f / std::max(bounds.halfArea(), 1e-20f);
+        for (int axis = 0; axis < 3; axis++) {
+            if (scale[axis] == 0.0f) continue;
+            span<const Bin> axisBins = bins.subspan(axis * binCount, binCount);
+            Bin             acc;
+            for (uint32_t b = binCount - 1; b > 0; b--) {
+                merge(acc, axisBins[b]);
+                suffix[b] = acc;
+            }
+            Bin prefix;
+            for (uint32_t b = 0; b + 1 < binCount; b++) {
+                merge(prefix, axisBins[b]);
+                const Bin &rest = suffix[b + 1];
+                if (prefix.count == 0 || rest.count == 0) continue;
+                float cost = options_.traversalCost +
+                             options_.intersectionCost * invArea *
+                                 (prefix.bounds.halfArea() * static_cast<float>(prefix.count) +
+                                  rest.bounds.halfArea() * static_cast<float>(rest.count));
+                if (cost < best.cost) {
+                    best = {axis, b, cost, prefix, rest};
+                }
+            }
+        }
+        return best;
+    }
+
+    [[nodiscard]] uint32_t
+    binIndex(const glm::vec3 &centroid, const AABB &bounds, const glm::vec3 &scale, int axis)
+        const {
+        auto bin = static_cast<int>((centroid[axis] - bounds.min[axis]) * scale[axis]);
+        return static_cast<uint32_t>(std::clamp(bin, 0, static_cast<int>(options_.binCount) - 1));
+    }
+
+    static void
+    merge(Bin &into, const Bin &from) {
+        into.bounds.grow(from.bounds);
+        into.centroids.grow(from.centroids);
+        into.count += from.count;
+    }
+
+    uint32_t
+    allocateNode(const AABB &bounds) {
+        uint32_t index       = nodeCount_.fetch_add(1, std::memory_order_relaxed);
+        nodes_[index].bounds = bounds;
+        return index;
+    }
+
+    uint32_t
+    makeLeaf(uint32_t first, uint32_t count, const AABB &bounds) {
+        uint32_t index      = allocateNode(bounds);
+        nodes_[index].first = first;
+        nodes_[index].count = count;
+        return index;
+    }
+
+    // Builds the subtree over indices_[first, first + range.count) and returns its root.
+    uint32_t
+    build(uint32_t first, const Bin &range, uint32_t depth) {
+        uint32_t    count  = range.count;
+        const AABB &bounds = range.bounds;
+        if (count <= 1 || depth + 1 >= BVHView::maxDepth) return makeLeaf(first, count, bounds);
+
+        Split split    = findSplit(first, count, depth, bounds, range.centroids);
+        float leafCost = options_.intersectionCost * static_cast<float>(count);
+        if (count <= options_.maxLeafSize && leafCost <= split.cost) {
+            return makeLeaf(first, count, bounds);
+        }
+
+        if (split.axis < 0) {
+            // The centroids coincide (or nearly so), so no plane separates them. Fall back to an
+            // arbitrary even split to keep leaves small.
+            if (count <= options_.maxLeafSize) return makeLeaf(first, count, bounds);
+            split.left  = gather(first, count / 2);
+            split.right = gather(first + count / 2, count - count / 2);
+        } else {
+            int       axis = split.axis;
+            glm::vec3 scale{0.0f};
+            scale[axis] = binScale(range.centroids, axis);
+            auto begin  = indices_.begin() + first;
+            std::partition(begin, begin + count, [&](uint32_t prim) {
+                return binIndex(centroids_[prim], range.centroids, scale, axis) <= split.bin;
+            });
+        }
+        uint32_t mid = first + split.left.count;
+
+        uint32_t node = allocateNode(bounds);
+        uint32_t left;
+        uint32_t right;
+
+        // Hand the left subtree to another thread near the root, where there are idle cores to
+        // take it. Deeper down every core already has a subtree of its own.
+        if (count >= options_.parallelThreshold && depth < spawnDepth_) {
+            auto task = std::async(std::launch::async, [&] {
+                return build(first, split.left, depth + 1);
+            });
+            right = build(mid, split.right, depth + 1);
+            left  = task.get();
+        } else {
+            left  = build(first, split.left, depth + 1);
+            right = build(mid, split.right, depth + 1);
+        }
+        nodes_[node].left  = left;
+        nodes_[node].right = right;
+        return node;
+    }
+};
+
+uint32_t
+flatten(const std::vector<BuildNode> &pool, uint32_t at, std::vector<BVHNode> &nodes) {
+    const BuildNode &node  = pool[at];
+    auto             index = static_cast<uint32_t>(nodes.size());
+    nodes.push_back({node.bounds.min, node.first, node.bounds.max, node.count});
+    if (node.count == 0) {
+        flatten(pool, node.left, nodes);
+        uint32_t right      = flatten(pool, node.right, nodes);
+        nodes[index].offset = right;
+    }
+    return index;
+}
+
+// Builds the tree over count primitives into nodes and primIndices.
+template<typename BoundsFn>
+void
+buildTree(
+    std::size_t            count,
+    BoundsFn             &&boundsOf,
+    const BVHBuildOptions &options,
+    std::vector<BVHNode>  &nodes,
+    std::vector<uint32_t> &primIndices) {
+    primIndices.resize(count);
+    std::iota(primIndices.begin(), primIndices.end(), 0u);
+
+    Builder  builder(count, boundsOf, options, primIndices);
+    uint32_t root = builder.buildRoot();
+    nodes.reserve(builder.nodeCount());
+    flatten(builder.nodes(), root, nodes);
+}
+
+// Children always come after their parent in the depth-first layout, so a single backwards pass
+// sees both children of a node before the node itself.
+template<typename BoundsFn>
+void
+refitTree(span<BVHNode> nodes, span<const uint32_t> primIndices, BoundsFn &&boundsOf) {
+    for (std::size_t i = nodes.size(); i-- > 0;) {
+        BVHNode &node = nodes[i];
+        AABB     bounds;
+        if (node.isLeaf()) {
+            for (uint32_t p = node.offset; p < node.offset + node.count; p++) {
+                bounds.grow(boundsOf(primIndices[p]));
+            }
+        } else {
+            bounds.grow(nodes[i + 1].bounds());
+            bounds.grow(nodes[node.offset].bounds());
+        }
+        node.min = bounds.min;
+        node.max = bounds.max;
+    }
+}
+
+} // namespace
+
+BVH
+BVH::build(const MeshView &mesh, const BVHBuildOptions &options) {
+    GLPT_PROFILE_SCOPE(profile::Zone::BVHBuild);
+    BVH bvh;
+    if (mesh.triangleCount() == 0) return bvh;
+    buildTree(
+        mesh.triangleCount(),
+        [&](std::size_t i) { return mesh.triangleBounds(i); },
+        options,
+        bvh.nodes_,
+        bvh.primIndices_);
+    bvh.builtCost_ = bvh.sahCost(options);
+    return bvh;
+}
+
+BVH
+BVH::build(span<const AABB> primBounds, const BVHBuildOptions &options) {
+    GLPT_PROFILE_SCOPE(profile::Zone::BVHBuild);
+    BVH bvh;
+    if (primBounds.empty()) return bvh;
+    buildTree(
+        primBounds.size(),
+        [&](std::size_t i) { return primBounds[i]; },
+        options,
+        bvh.nodes_,
+        bvh.primIndices_);
+    bvh.builtCost_ = bvh.sahCost(options);
+    return bvh;
+}
+
+void
+BVH::refit(const MeshView &mesh) {
+    GLPT_PROFILE_SCOPE(profile::Zone::BVHRefit);
+    checkPrimitiveCount(mesh.triangleCount());
+    refitTree(nodes_, primIndices_, [&](uint32_t prim) { return mesh.triangleBounds(prim); });
+}
+
+void
+BVH::refit(span<const AABB> primBounds) {
+    GLPT_PROFILE_SCOPE(profile::Zone::BVHRefit);
+    checkPrimitiveCount(primBounds.size());
+    refitTree(nodes_, primIndices_, [&](uint32_t prim) { return primBounds[prim]; });
+}
+
+void
+BVH::checkPrimitiveCount(std::size_t count) const {
+    // Every primitive is in exactly one leaf, so a tree over a different number of them would
+    // read past the end of the new data or leave some of it out.
+    if (count != primIndices_.size()) {
+        throw std::invalid_argument(
+            "BVH was built over " + std::to_string(primIndices_.size()) +
+            " primitives but refit with " + std::to_string(count));
+    }
+}
+
+BVHUpdate
+BVH::update(const MeshView &mesh, const BVHBuildOptions &options) {
+    if (!nodes_.empty()) {
+        refit(mesh);
+        if (sahCost(options) <= builtCost_ * options.rebuildThreshold) return BVHUpdate::Refit;
+    }
+    *this = build(mesh, options);
+    return BVHUpdate::Rebuild;
+}
+
+BVHUpdate
+BVH::update(span<const AABB> primBounds, const BVHBuildOptions &options) {
+    if (!nodes_.empty()) {
+        refit(primBounds);
+        if (sahCost(options) <= builtCost_ * options.rebuildThreshold) return BVHUpdate::Refit;
+    }
+    *this = build(primBounds, options);
+    return BVHUpdate::Rebuild;
+}
+
+float
+BVH::sahCost(const BVHBuildOptions &options) const {
+    if (nodes_.empty()) return 0.0f;
+    // Summed in double: a large tree has millions of terms of very different sizes.
+    double cost = 0.0;
+    for (const BVHNode &node : nodes_) {
+        double area = node.bounds().halfArea();
+        cost += node.isLeaf() ? area * options.intersectionCost * node.count
+                              : area * options.traversalCost;
+    }
+    double rootArea = nodes_.front().bounds().halfArea();
+    return rootArea > 0.0 ? static_cast<float>(cost / rootArea) : 0.0f;
+}
+
+bool
+BVHView::intersect(const Ray &ray, const MeshView &mesh, Hit &hit) const {
+    profile::TraversalCounter counter(false);
+    return traverse<false>(
+        ray, std::min(ray.tMax, hit.t), counter, [&](const BVHNode &leaf, float &tMax) {
+            counter.testTriangles(leaf.count);
+            return intersectLeaf<false>(leaf, ray, mesh, tMax, hit);
+        });
+}
+
+bool
+BVHView::occluded(const Ray &ray, const MeshView &mesh) const {
+    profile::TraversalCounter counter(true);
+    Hit                       hit;
+    return traverse<true>(ray, ray.tMax, counter, [&](const BVHNode &leaf, float &tMax) {
+        counter.testTriangles(leaf.count);
+        return intersectLeaf<true>(leaf, ray, mesh, tMax, hit);
+    });
+}
+
+} // namespace glpt
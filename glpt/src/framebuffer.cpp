@@ -0,0 +1,111 @@
+//
+// Created by taylor-santos on 10/16/2026 at 17:31.
+//
+
+#include "framebuffer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace glpt {
+
+namespace {
+
+float
+luminance(const glm::vec3 &c) {
+    return 0.2126f * c.x + 0.7152f * c.y + 0.0722f * c.z;
+}
+
+} // namespace
+
+void
+PixelAccumulator::add(const glm::vec3 &sample) {
+    float y = luminance(sample);
+    sum += sample;
+    luminanceSquaredSum += y * y;
+    count++;
+}
+
+float
+PixelAccumulator::relativeError() const {
+    if (count < 2) return std::numeric_limits<float>::infinity();
+    auto  n        = static_cast<float>(count);
+    float mean     = luminance(sum) / n;
+    float variance = std::max(0.0f, (luminanceSquaredSum / n - mean * mean) * n / (n - 1.0f));
+    // Offset the denominator so that black pixels converge instead of dividing by zero.
+    return std::sqrt(variance / n) / (mean + 1e-3f);
+}
+
+Framebuffer::Framebuffer(uint32_t width, uint32_t height, uint32_t tileSize)
+    : grid_{width, height, std::max(tileSize, 1u)}
+    , tilePixels_{grid_.tileSize * grid_.tileSize}
+    , accumulators_(static_cast<std::size_t>(grid_.count()) * tilePixels_)
+    , tileConverged_(grid_.count(), 0)
+    , published_(static_cast<std::size_t>(grid_.count()) * 3 * tilePixels_, glm::vec3{0.0f})
+    , back_(grid_.count(), 0)
+    , middle_{std::make_unique<std::atomic<uint32_t>[]>(grid_.count())}
+    , front_(grid_.count(), 2) {
+    for (uint32_t tile = 0; tile < grid_.count(); tile++) {
+        middle_[tile].store(1, std::memory_order_relaxed);
+    }
+}
+
+std::size_t
+Framebuffer::slot(uint32_t x, uint32_t y) const {
+    uint32_t tile  = y / grid_.tileSize * grid_.columns() + x / grid_.tileSize;
+    uint32_t local = y % grid_.tileSize * grid_.tileSize + x % grid_.tileSize;
+    return static_cast<std::size_t>(tile) * tilePixels_ + local;
+}
+
+void
+Framebuffer::publish(uint32_t tile) {
+    TileRect                rect = grid_.rect(tile);
+    glm::vec3              *back = buffer(tile, back_[tile]);
+    const PixelAccumulator *acc  = &accumulators_[static_cast<std::size_t>(tile) * tilePixels_];
+
+    bool converged = true;
+    for (uint32_t y = rect.y0; y < rect.y1; y++) {
+        for (uint32_t x = rect.x0; x < rect.x1; x++) {
+            uint32_t local = (y - rect.y0) * grid_.tileSize + (x - rect.x0);
+            back[local]    = acc[local].mean();
+            converged &= acc[local].converged;
+        }
+    }
+    tileConverged_[tile] = converged;
+    // Release makes the buffer contents visible to the reader that acquires it.
+    uint32_t previous = middle_[tile].exchange(back_[tile] | dirtyBit, std::memory_order_acq_rel);
+    back_[tile]       = static_cast<uint8_t>(previous & ~dirtyBit);
+}
+
+void
+Framebuffer::reset() {
+    std::fill(accumulators_.begin(), accumulators_.end(), PixelAccumulator{});
+    std::fill(tileConverged_.begin(), tileConverged_.end(), 0);
+    // Publish a black tile everywhere so readers drop what they had.
+    for (uint32_t tile = 0; tile < grid_.count(); tile++) {
+        publish(tile);
+    }
+}
+
+void
+Framebuffer::snapshot(Image &image) const {
+    if (image.width != grid_.width || image.height != grid_.height) {
+        image = Image(grid_.width, grid_.height);
+    }
+    std::lock_guard lock(readerMutex_);
+    for (uint32_t tile = 0; tile < grid_.count(); tile++) {
+        if (middle_[tile].load(std::memory_order_relaxed) & dirtyBit) {
+            uint32_t previous = middle_[tile].exchange(front_[tile], std::memory_order_acq_rel);
+            front_[tile]      = static_cast<uint8_t>(previous & ~dirtyBit);
+        }
+        TileRect         rect  = grid_.rect(tile);
+        const glm::vec3 *front = buffer(tile, front_[tile]);
+        for (uint32_t y = rect.y0; y < rect.y1; y++) {
+            const glm::vec3 *row = front + (y - rect.y0) * grid_.tileSize;
+            std::copy(row, row + (rect.x1 - rect.x0), &image.at(rect.x0, y));
+        }
+    }
+}
+
+} // namespace glpt
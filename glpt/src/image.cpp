@@ -0,0 +1,40 @@
+//
+// Created by taylor-santos on 10/16/2026 at 15:02.
+//
+
+#include "image.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace glpt {
+
+unsigned char
+encodeSRGB(float linear) {
+    float c = std::clamp(linear, 0.0f, 1.0f);
+    c       = c <= 0.0031308f ? 12.92f * c : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+    return static_cast<unsigned char>(std::lround(c * 255.0f));
+}
+
+bool
+writePPM(const Image &image, const std::string &path) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) return false;
+    file << "P6\n" << image.width << ' ' << image.height << "\n255\n";
+    std::vector<unsigned char> row(static_cast<std::size_t>(image.width) * 3);
+    for (uint32_t y = 0; y < image.height; y++) {
+        for (uint32_t x = 0; x < image.width; x++) {
+            const glm::vec3 &pixel = image.at(x, y);
+            for (int c = 0; c < 3; c++) {
+                row[static_cast<std::size_t>(x) * 3 + c] = encodeSRGB(pixel[c]);
+            }
+        }
+        file.write(
+            reinterpret_cast<const char *>(row.data()),
+            static_cast<std::streamsize>(row.size()));
+    }
+    return static_cast<bool>(file);
+}
+
+} // namespace glpt
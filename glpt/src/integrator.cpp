@@ -0,0 +1,109 @@
+//
+// Created by taylor-santos on 10/16/2026 at 14:40.
+//
+
+#include "integrator.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "sampling.hpp"
+
+namespace glpt {
+
+LightSample
+sampleLight(const SceneView &scene, const glm::vec3 &point, Pcg32 &rng) {
+    float u0 = rng.nextFloat();
+    float u1 = rng.nextFloat();
+    float u2 = rng.nextFloat();
+
+    LightSample sample;
+    if (scene.lights.empty()) return sample;
+
+    auto              lightCount = static_cast<uint32_t>(scene.lights.size());
+    auto              index = static_cast<uint32_t>(u0 * static_cast<float>(lightCount));
+    uint32_t          prim  = scene.lights[std::min(index, lightCount - 1)];
+    const glm::uvec3 &tri   = scene.mesh.triangles[prim];
+    glm::vec3         onLight = sampleTriangle(
+        scene.mesh.positions[tri.x],
+        scene.mesh.positions[tri.y],
+        scene.mesh.positions[tri.z],
+        u1,
+        u2);
+
+    glm::vec3 normal  = triangleNormal(scene.mesh, prim);
+    float     area2   = glm::length(normal);
+    glm::vec3 toLight = onLight - point;
+    float     dist2   = glm::dot(toLight, toLight);
+    if (area2 <= 0.0f || dist2 <= 0.0f) return sample;
+    float     distance = std::sqrt(dist2);
+    glm::vec3 dir      = toLight / distance;
+    // Emitters are one-sided, so only the front face contributes.
+    float cosLight = -glm::dot(normal, dir) / area2;
+    if (cosLight <= 0.0f) return sample;
+
+    // pdf_area = 1 / (lightCount * area), converted to solid angle by dist^2 / cosLight.
+    float area       = 0.5f * area2;
+    sample.direction = dir;
+    sample.distance  = distance;
+    sample.weight    = scene.materialOf(prim).emission *
+                    (cosLight * area * static_cast<float>(lightCount) / dist2);
+    return sample;
+}
+
+glm::vec3
+tracePath(const SceneView &scene, Ray ray, Pcg32 &rng, const IntegratorSettings &settings) {
+    profile::ZoneAccumulator shade(profile::Zone::Shade);
+    return tracePath(scene, ray, rng, settings, shade);
+}
+
+glm::vec3
+tracePath(
+    const SceneView          &scene,
+    Ray                       ray,
+    Pcg32                    &rng,
+    const IntegratorSettings &settings,
+    profile::ZoneAccumulator &shade) {
+    glm::vec3 radiance{0.0f};
+    glm::vec3 throughput{1.0f};
+    for (uint32_t bounce = 0;; bounce++) {
+        InstanceHit hit;
+        if (!scene.intersect(ray, hit)) break;
+        profile::ZoneAccumulator::Stretch shading(shade);
+
+        const Material &material = scene.materialOf(hit);
+        glm::vec3       normal   = glm::normalize(scene.normal(hit));
+        bool            front    = glm::dot(normal, ray.direction) < 0.0f;
+        // Light sources are only hit directly by camera rays, afterwards NEE accounts for them.
+        if (bounce == 0 && front) radiance += throughput * material.emission;
+        if (bounce == settings.maxBounces) break;
+
+        if (!front) normal = -normal;
+        glm::vec3 point = ray.origin + ray.direction * hit.t + normal * rayEpsilon;
+
+        LightSample light      = sampleLight(scene, point, rng);
+        float       cosSurface = glm::dot(normal, light.direction);
+        if (cosSurface > 0.0f && light.weight != glm::vec3{0.0f}) {
+            Ray shadow{point, light.direction, 0.0f, light.distance * (1.0f - rayEpsilon)};
+            if (!scene.occluded(shadow)) {
+                radiance += throughput * material.albedo * light.weight * (cosSurface / pi);
+            }
+        }
+
+        // Cosine-weighted sampling cancels the Lambertian cos / pi against its pdf.
+        float u1 = rng.nextFloat();
+        float u2 = rng.nextFloat();
+        ray      = {point, sampleCosineHemisphere(normal, u1, u2)};
+        throughput *= material.albedo;
+
+        if (bounce + 1 >= settings.rouletteDepth) {
+            float maxComponent = std::max(throughput.x, std::max(throughput.y, throughput.z));
+            float survive      = std::min(maxComponent, 0.95f);
+            if (rng.nextFloat() >= survive) break;
+            throughput /= survive;
+        }
+    }
+    return radiance;
+}
+
+} // namespace glpt
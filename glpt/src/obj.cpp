@@ -0,0 +1,192 @@
+//
+// Created by taylor-santos on 10/16/2026 at 20:41.
+//
+
+#include "obj.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace glpt {
+
+namespace {
+
+std::string
+readFile(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error("cannot open " + path);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return std::move(contents).str();
+}
+
+// Minimal cursor over one line of text. OBJ and MTL are both whitespace-separated line formats.
+class Line {
+public:
+    explicit Line(std::string_view text)
+        : text_{text} {}
+
+    std::string_view
+    word() {
+        skipSpace();
+        std::size_t end = 0;
+        while (end < text_.size() && !isSpace(text_[end])) end++;
+        std::string_view result = text_.substr(0, end);
+        text_.remove_prefix(end);
+        return result;
+    }
+
+    [[nodiscard]] std::string_view
+    rest() {
+        skipSpace();
+        std::string_view result = text_;
+        while (!result.empty() && isSpace(result.back())) result.remove_suffix(1);
+        return result;
+    }
+
+    float
+    number() {
+        std::string token(word());
+        char       *end;
+        float       value = std::strtof(token.c_str(), &end);
+        if (token.empty() || *end != '\0') throw std::runtime_error("expected a number");
+        return value;
+    }
+
+    glm::vec3
+    vec3() {
+        float x = number();
+        float y = number();
+        float z = number();
+        return {x, y, z};
+    }
+
+private:
+    std::string_view text_;
+
+    static bool
+    isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    void
+    skipSpace() {
+        while (!text_.empty() && isSpace(text_.front())) text_.remove_prefix(1);
+    }
+};
+
+template<typename Fn>
+void
+forEachLine(const std::string &text, const std::string &file, Fn &&fn) {
+    std::size_t lineNumber = 0;
+    for (std::size_t start = 0; start < text.size();) {
+        std::size_t end = text.find('\n', start);
+        if (end == std::string::npos) end = text.size();
+        lineNumber++;
+        std::string_view line(text.data() + start, end - start);
+        start = end + 1;
+        if (auto comment = line.find('#'); comment != std::string_view::npos) {
+            line = line.substr(0, comment);
+        }
+        try {
+            fn(Line(line));
+        } catch (const std::runtime_error &e) {
+            throw std::runtime_error(file + ":" + std::to_string(lineNumber) + ": " + e.what());
+        }
+    }
+}
+
+// Everything up to and including the last path separator. Done by hand because GCC 8 keeps
+// std::filesystem in a separate library.
+std::string
+directoryOf(const std::string &path) {
+    auto separator = path.find_last_of("/\\");
+    return separator == std::string::npos ? std::string{} : path.substr(0, separator + 1);
+}
+
+void
+loadMtl(
+    const std::string                         &path,
+    std::vector<Material>                     &materials,
+    std::unordered_map<std::string, uint32_t> &names) {
+    std::string text    = readFile(path);
+    Material   *current = nullptr;
+    forEachLine(text, path, [&](Line line) {
+        std::string_view keyword = line.word();
+        if (keyword == "newmtl") {
+            names[std::string(line.rest())] = static_cast<uint32_t>(materials.size());
+            current                         = &materials.emplace_back();
+        } else if (keyword == "Kd" && current) {
+            current->albedo = line.vec3();
+        } else if (keyword == "Ke" && current) {
+            current->emission = line.vec3();
+        }
+    });
+}
+
+} // namespace
+
+Scene
+loadObj(const std::string &path) {
+    std::string text = readFile(path);
+
+    Scene                                     scene;
+    std::unordered_map<std::string, uint32_t> materialNames;
+    uint32_t                                  currentMaterial = 0;
+    scene.materials.emplace_back(); // Default material for faces before any usemtl.
+
+    std::vector<uint32_t> face;
+    forEachLine(text, path, [&](Line line) {
+        std::string_view keyword = line.word();
+        if (keyword == "v") {
+            scene.mesh.positions.push_back(line.vec3());
+        } else if (keyword == "f") {
+            face.clear();
+            auto vertexCount = static_cast<long>(scene.mesh.positions.size());
+            for (std::string_view vertex = line.word(); !vertex.empty(); vertex = line.word()) {
+                // Only the position index before the first '/' matters.
+                std::string token(vertex.substr(0, vertex.find('/')));
+                char       *end;
+                long        index = std::strtol(token.c_str(), &end, 10);
+                if (token.empty() || *end != '\0') throw std::runtime_error("bad face index");
+                if (index < 0) index += vertexCount + 1;
+                if (index < 1 || index > vertexCount) {
+                    throw std::runtime_error("face index out of range");
+                }
+                face.push_back(static_cast<uint32_t>(index - 1));
+            }
+            if (face.size() < 3) throw std::runtime_error("face has fewer than 3 vertices");
+            for (std::size_t i = 1; i + 1 < face.size(); i++) {
+                scene.mesh.triangles.push_back({face[0], face[i], face[i + 1]});
+                scene.triangleMaterials.push_back(currentMaterial);
+            }
+        } else if (keyword == "mtllib") {
+            loadMtl(directoryOf(path) + std::string(line.rest()), scene.materials, materialNames);
+        } else if (keyword == "usemtl") {
+            auto it = materialNames.find(std::string(line.rest()));
+            if (it == materialNames.end()) throw std::runtime_error("unknown material");
+            currentMaterial = it->second;
+        }
+    });
+
+    // Frame the bounding sphere of the model with the default field of view.
+    AABB bounds;
+    for (const auto &p : scene.mesh.positions) bounds.grow(p);
+    if (!bounds.empty()) {
+        float radius   = 0.5f * glm::length(bounds.extent());
+        float distance = std::max(radius / std::sin(scene.camera.verticalFov * 0.5f), 1e-3f);
+
+        scene.camera.target   = bounds.center();
+        scene.camera.position = bounds.center() + glm::vec3{0.0f, 0.0f, distance};
+    }
+    return scene;
+}
+
+} // namespace glpt
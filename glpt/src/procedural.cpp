@@ -0,0 +1,152 @@
+//
+// Created by taylor-santos on 10/16/2026 at 09:39.
+//
+
+#include "procedural.hpp"
+
+#include <array>
+#include <cmath>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "random.hpp"
+#include "sampling.hpp"
+
+namespace glpt {
+
+Mesh
+makeTriangleSoup(std::size_t count, uint32_t seed) {
+    Mesh  mesh;
+    Pcg32 rng(seed);
+    // Scale triangles with density so that the expected overlap stays roughly constant.
+    float size = count > 0 ? 2.0f / std::cbrt(static_cast<float>(count)) : 0.0f;
+    mesh.positions.reserve(count * 3);
+    mesh.triangles.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        glm::vec3 center{rng.nextFloat(), rng.nextFloat(), rng.nextFloat()};
+        auto      first = static_cast<uint32_t>(mesh.positions.size());
+        for (int v = 0; v < 3; v++) {
+            glm::vec3 offset{rng.nextFloat(), rng.nextFloat(), rng.nextFloat()};
+            mesh.positions.push_back(center + (offset - 0.5f) * size);
+        }
+        mesh.triangles.push_back({first, first + 1, first + 2});
+    }
+    return mesh;
+}
+
+Mesh
+makeQuad(const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c, const glm::vec3 &d) {
+    Mesh mesh;
+    mesh.positions = {a, b, c, d};
+    mesh.triangles = {{0, 1, 2}, {0, 2, 3}};
+    return mesh;
+}
+
+Mesh
+makeBox(const glm::vec3 &center, const glm::vec3 &size, float angle) {
+    float c = std::cos(angle);
+    float s = std::sin(angle);
+    Mesh  mesh;
+    for (int i = 0; i < 8; i++) {
+        glm::vec3 corner = (glm::vec3{
+                                static_cast<float>(i & 1),
+                                static_cast<float>((i >> 1) & 1),
+                                static_cast<float>((i >> 2) & 1)} -
+                            0.5f) *
+                           size;
+        mesh.positions.push_back(
+            center + glm::vec3{c * corner.x + s * corner.z, corner.y, c * corner.z - s * corner.x});
+    }
+    // Corner i has x = bit 0, y = bit 1, z = bit 2. Each face is listed counter-clockwise as seen
+    // from outside.
+    constexpr std::array<std::array<uint32_t, 4>, 6> faces{{
+        {0, 4, 6, 2}, // -x
+        {1, 3, 7, 5}, // +x
+        {0, 1, 5, 4}, // -y
+        {2, 6, 7, 3}, // +y
+        {0, 2, 3, 1}, // -z
+        {4, 5, 7, 6}, // +z
+    }};
+    for (const auto &f : faces) {
+        mesh.triangles.push_back({f[0], f[1], f[2]});
+        mesh.triangles.push_back({f[0], f[2], f[3]});
+    }
+    return mesh;
+}
+
+Scene
+makeCornellBox() {
+    const Material white{{0.73f, 0.73f, 0.73f}};
+    const Material red{{0.65f, 0.05f, 0.05f}};
+    const Material green{{0.12f, 0.45f, 0.15f}};
+    const Material light{{0.78f, 0.78f, 0.78f}, {17.0f, 12.0f, 4.0f}};
+
+    Scene scene;
+    // Walls face into the box.
+    scene.add(makeQuad({0, 0, 0}, {0, 0, 1}, {1, 0, 1}, {1, 0, 0}), white); // floor
+    scene.add(makeQuad({0, 1, 0}, {1, 1, 0}, {1, 1, 1}, {0, 1, 1}), white); // ceiling
+    scene.add(makeQuad({0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}), white); // back
+    scene.add(makeQuad({0, 0, 0}, {0, 1, 0}, {0, 1, 1}, {0, 0, 1}), red);   // left
+    scene.add(makeQuad({1, 0, 0}, {1, 0, 1}, {1, 1, 1}, {1, 1, 0}), green); // right
+    // Light faces down, slightly below the ceiling.
+    float y = 0.999f;
+    scene.add(makeQuad({0.4f, y, 0.4f}, {0.6f, y, 0.4f}, {0.6f, y, 0.6f}, {0.4f, y, 0.6f}), light);
+    scene.add(makeBox({0.35f, 0.3f, 0.35f}, {0.3f, 0.6f, 0.3f}, 0.3f), white);
+    scene.add(makeBox({0.68f, 0.15f, 0.65f}, {0.3f, 0.3f, 0.3f}, -0.3f), white);
+
+    scene.camera.position    = {0.5f, 0.5f, 2.4f};
+    scene.camera.target      = {0.5f, 0.5f, 0.0f};
+    scene.camera.verticalFov = glm::radians(38.0f);
+    scene.commit();
+    return scene;
+}
+
+InstancedScene
+makeInstancedCornellBox(uint32_t count, uint32_t seed) {
+    InstancedScene result;
+    result.scene = makeCornellBox();
+    // Appending materials is fine after commit(): only the light list depends on them, and
+    // instances are never lights.
+    auto firstMaterial = static_cast<uint32_t>(result.scene.materials.size());
+    result.scene.materials.push_back({{0.15f, 0.25f, 0.70f}});
+    result.scene.materials.push_back({{0.80f, 0.60f, 0.10f}});
+    result.scene.materials.push_back({{0.73f, 0.73f, 0.73f}});
+
+    // A unit cube standing on the origin.
+    result.blasMesh = makeBox({0.0f, 0.5f, 0.0f}, glm::vec3{1.0f}, 0.0f);
+    result.blasBvh  = BVH::build(result.blasMesh.view());
+
+    Pcg32                 rng(seed);
+    std::vector<Instance> instances;
+    instances.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        glm::vec3 position{0.05f + 0.9f * rng.nextFloat(), 0.0f, 0.05f + 0.9f * rng.nextFloat()};
+        float     angle     = rng.nextFloat() * 2.0f * pi;
+        float     size      = 0.03f + 0.05f * rng.nextFloat();
+        glm::mat4 transform = glm::translate(glm::mat4(1.0f), position);
+        transform           = glm::rotate(transform, angle, {0.0f, 1.0f, 0.0f});
+        transform           = glm::scale(transform, glm::vec3{size});
+        instances.push_back({0, transform, firstMaterial + i % 3});
+    }
+    result.tlas = TLAS::build({{result.blasMesh.view(), result.blasBvh.view()}}, instances);
+    return result;
+}
+
+Scene
+makeSoupScene(std::size_t count, uint32_t seed) {
+    const Material grey{{0.6f, 0.6f, 0.6f}};
+    const Material light{{0.0f, 0.0f, 0.0f}, {8.0f, 8.0f, 8.0f}};
+
+    Scene scene;
+    scene.add(makeTriangleSoup(count, seed), grey);
+    // A large light above the cube, facing down.
+    float y = 1.5f, lo = -0.5f, hi = 1.5f;
+    scene.add(makeQuad({lo, y, lo}, {hi, y, lo}, {hi, y, hi}, {lo, y, hi}), light);
+
+    scene.camera.position = {0.5f, 0.6f, 2.2f};
+    scene.camera.target   = {0.5f, 0.5f, 0.5f};
+    scene.commit();
+    return scene;
+}
+
+} // namespace glpt
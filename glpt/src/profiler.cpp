@@ -0,0 +1,266 @@
+//
+// Created by taylor-santos on 10/16/2026 at 23:05.
+//
+
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <ostream>
+#include <mutex>
+
+namespace glpt::profile {
+
+namespace {
+
+// Owns every thread record. Records are handed out when a thread first records something, or
+// earlier through reset() or a thread pool starting, and returned to the free list when it exits,
+// so the number of records is bounded by the number of threads alive at once, not by how many
+// were ever created. Trace buffers are allocated with the record or by setTracing().
+struct Registry {
+    std::mutex                                          mutex;
+    std::vector<std::unique_ptr<detail::ThreadRecord>> records;
+    std::vector<detail::ThreadRecord *>                 free;
+};
+
+Registry &
+registry() {
+    static Registry instance;
+    return instance;
+}
+
+// Prints nanoseconds as microseconds with three decimals, the unit of Chrome trace timestamps.
+struct Microseconds {
+    uint64_t nanoseconds;
+};
+
+std::ostream &
+operator<<(std::ostream &out, Microseconds time) {
+    char fraction[4] = {
+        static_cast<char>('0' + time.nanoseconds % 1000 / 100),
+        static_cast<char>('0' + time.nanoseconds % 100 / 10),
+        static_cast<char>('0' + time.nanoseconds % 10),
+        '\0'};
+    return out << time.nanoseconds / 1000 << '.' << fraction;
+}
+
+void
+allocateEvents(detail::ThreadRecord &record) {
+    if (!record.events) record.events = std::make_unique<detail::TraceEvent[]>(maxTraceEvents);
+}
+
+struct Claim {
+    detail::ThreadRecord *record;
+
+    Claim() {
+        Registry       &r = registry();
+        std::lock_guard lock(r.mutex);
+        if (r.free.empty()) {
+            r.records.push_back(std::make_unique<detail::ThreadRecord>());
+            record     = r.records.back().get();
+            record->id = static_cast<uint32_t>(r.records.size() - 1);
+        } else {
+            // Lowest id first, so that worker threads keep small ids across pools.
+            auto lowest = std::min_element(r.free.begin(), r.free.end(), [](auto *a, auto *b) {
+                return a->id < b->id;
+            });
+            record = *lowest;
+            r.free.erase(lowest);
+        }
+        if (detail::tracing.load(std::memory_order_relaxed)) allocateEvents(*record);
+    }
+
+    ~Claim() {
+        Registry       &r = registry();
+        std::lock_guard lock(r.mutex);
+        r.free.push_back(record);
+    }
+
+    Claim(const Claim &) = delete;
+    Claim &
+    operator=(const Claim &) = delete;
+};
+
+} // namespace
+
+namespace detail {
+
+std::atomic<bool> tracing{false};
+
+ThreadRecord &
+threadRecord() {
+    thread_local Claim claim;
+    return *claim.record;
+}
+
+uint64_t
+now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+void
+record(Zone zone, uint64_t start, uint64_t end) {
+    ThreadRecord &r     = threadRecord();
+    auto          index = static_cast<std::size_t>(zone);
+    add(r.zoneCalls[index], 1);
+    add(r.zoneNanoseconds[index], end - start);
+    // Acquire pairs with setTracing(), so the buffer it allocated is visible.
+    if (!tracing.load(std::memory_order_acquire)) return;
+
+    uint32_t count = r.eventCount.load(std::memory_order_relaxed);
+    if (count == maxTraceEvents) return;
+    r.events[count] = {zone, start, end - start};
+    r.eventCount.store(count + 1, std::memory_order_release);
+}
+
+void
+accumulate(Zone zone, uint64_t calls, uint64_t nanoseconds) {
+    ThreadRecord &r     = threadRecord();
+    auto          index = static_cast<std::size_t>(zone);
+    add(r.zoneCalls[index], calls);
+    add(r.zoneNanoseconds[index], nanoseconds);
+}
+
+} // namespace detail
+
+const char *
+name(Zone zone) {
+    switch (zone) {
+        case Zone::BVHBuild: return "BVH build";
+        case Zone::WideBVHBuild: return "Wide BVH build";
+        case Zone::BVHRefit: return "BVH refit";
+        case Zone::WideBVHRefit: return "Wide BVH refit";
+        case Zone::RenderTile: return "Render tile";
+        case Zone::Shade: return "Shade";
+        case Zone::WavefrontGenerate: return "Wavefront generate";
+        case Zone::WavefrontExtend: return "Wavefront extend";
+        case Zone::WavefrontSort: return "Wavefront sort";
+        case Zone::WavefrontShade: return "Wavefront shade";
+        case Zone::WavefrontConnect: return "Wavefront connect";
+        case Zone::Idle: return "Idle";
+        case Zone::Count: break;
+    }
+    return "?";
+}
+
+const char *
+name(Counter counter) {
+    switch (counter) {
+        case Counter::Rays: return "Rays";
+        case Counter::ShadowRays: return "Shadow rays";
+        case Counter::NodeVisits: return "Node visits";
+        case Counter::TriangleTests: return "Triangle tests";
+        case Counter::Count: break;
+    }
+    return "?";
+}
+
+ZoneStats
+Stats::total(Zone zone) const {
+    ZoneStats sum;
+    for (const ThreadStats &thread : threads) {
+        sum.calls += thread.zones[static_cast<std::size_t>(zone)].calls;
+        sum.nanoseconds += thread.zones[static_cast<std::size_t>(zone)].nanoseconds;
+    }
+    return sum;
+}
+
+uint64_t
+Stats::total(Counter counter) const {
+    uint64_t sum = 0;
+    for (const ThreadStats &thread : threads) {
+        sum += thread.counters[static_cast<std::size_t>(counter)];
+    }
+    return sum;
+}
+
+Stats
+stats() {
+    Registry       &r = registry();
+    std::lock_guard lock(r.mutex);
+    Stats           result;
+    result.threads.reserve(r.records.size());
+    for (const auto &record : r.records) {
+        ThreadStats &thread = result.threads.emplace_back();
+        thread.thread       = record->id;
+        for (std::size_t i = 0; i < zoneCount; i++) {
+            ZoneStats &zone  = thread.zones[i];
+            zone.calls       = record->zoneCalls[i].load(std::memory_order_relaxed);
+            zone.nanoseconds = record->zoneNanoseconds[i].load(std::memory_order_relaxed);
+        }
+        for (std::size_t i = 0; i < counterCount; i++) {
+            thread.counters[i] = record->counters[i].load(std::memory_order_relaxed);
+        }
+    }
+    return result;
+}
+
+void
+reset() {
+    if constexpr (enabled) static_cast<void>(detail::threadRecord());
+    Registry       &r = registry();
+    std::lock_guard lock(r.mutex);
+    for (const auto &record : r.records) {
+        for (std::size_t i = 0; i < zoneCount; i++) {
+            record->zoneCalls[i].store(0, std::memory_order_relaxed);
+            record->zoneNanoseconds[i].store(0, std::memory_order_relaxed);
+        }
+        for (auto &counter : record->counters) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+        record->eventCount.store(0, std::memory_order_relaxed);
+    }
+}
+
+void
+setTracing(bool enabled) {
+    Registry       &r = registry();
+    std::lock_guard lock(r.mutex);
+    if (enabled) {
+        for (const auto &record : r.records) {
+            allocateEvents(*record);
+        }
+    }
+    detail::tracing.store(enabled, std::memory_order_release);
+}
+
+bool
+writeChromeTrace(const std::string &path) {
+    std::ofstream file(path);
+    if (!file) return false;
+
+    Registry       &r = registry();
+    std::lock_guard lock(r.mutex);
+    // Timestamps are relative to the first event so that they stay readable.
+    uint64_t origin = UINT64_MAX;
+    for (const auto &record : r.records) {
+        uint32_t count = record->eventCount.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < count; i++) {
+            origin = std::min(origin, record->events[i].start);
+        }
+    }
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    const char *separator = "\n";
+    for (const auto &record : r.records) {
+        uint32_t count = record->eventCount.load(std::memory_order_acquire);
+        if (count == 0) continue;
+        file << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":"
+             << record->id << ",\"args\":{\"name\":\"thread " << record->id << "\"}}";
+        separator = ",\n";
+        for (uint32_t i = 0; i < count; i++) {
+            const detail::TraceEvent &event = record->events[i];
+            file << separator << "{\"name\":\"" << name(event.zone)
+                 << "\",\"cat\":\"glpt\",\"ph\":\"X\",\"pid\":0,\"tid\":" << record->id
+                 << ",\"ts\":" << Microseconds{event.start - origin}
+                 << ",\"dur\":" << Microseconds{event.duration} << '}';
+        }
+    }
+    file << "\n]}\n";
+    return static_cast<bool>(file);
+}
+
+} // namespace glpt::profile
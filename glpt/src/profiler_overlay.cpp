@@ -0,0 +1,90 @@
+//
+// Created by taylor-santos on 10/16/2026 at 23:40.
+//
+
+#include "profiler.hpp"
+
+#include <imgui.h>
+
+namespace glpt::profile {
+
+namespace {
+
+double
+perRay(uint64_t total, uint64_t rays) {
+    return rays ? static_cast<double>(total) / static_cast<double>(rays) : 0.0;
+}
+
+} // namespace
+
+void
+drawOverlay(const Stats &stats, bool *open) {
+    if (!ImGui::Begin("Profiler", open, ImGuiWindowFlags_AlwaysAutoResize)) {
+        ImGui::End();
+        return;
+    }
+    if (!enabled) {
+        ImGui::TextUnformatted("Built without GLPT_ENABLE_PROFILING.");
+        ImGui::End();
+        return;
+    }
+
+    const ImGuiTableFlags tableFlags =
+        ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit;
+    if (ImGui::BeginTable("zones", 4, tableFlags)) {
+        ImGui::TableSetupColumn("Zone");
+        ImGui::TableSetupColumn("Calls");
+        ImGui::TableSetupColumn("Total (ms)");
+        ImGui::TableSetupColumn("Mean (us)");
+        ImGui::TableHeadersRow();
+        for (std::size_t i = 0; i < zoneCount; i++) {
+            auto      zone  = static_cast<Zone>(i);
+            ZoneStats total = stats.total(zone);
+            if (total.calls == 0) continue;
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(name(zone));
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(total.calls));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", total.milliseconds());
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", total.milliseconds() * 1e3 / static_cast<double>(total.calls));
+        }
+        ImGui::EndTable();
+    }
+
+    uint64_t rays = stats.total(Counter::Rays) + stats.total(Counter::ShadowRays);
+    ImGui::Separator();
+    ImGui::Text(
+        "%llu rays, %llu of them shadow rays",
+        static_cast<unsigned long long>(rays),
+        static_cast<unsigned long long>(stats.total(Counter::ShadowRays)));
+    ImGui::Text("%.1f node visits per ray", perRay(stats.total(Counter::NodeVisits), rays));
+    ImGui::Text("%.1f triangle tests per ray", perRay(stats.total(Counter::TriangleTests), rays));
+
+    ImGui::Separator();
+    if (ImGui::BeginTable("threads", 3, tableFlags)) {
+        ImGui::TableSetupColumn("Thread");
+        ImGui::TableSetupColumn("Rays");
+        ImGui::TableSetupColumn("Idle (ms)");
+        ImGui::TableHeadersRow();
+        for (const ThreadStats &thread : stats.threads) {
+            uint64_t threadRays = thread.counters[static_cast<std::size_t>(Counter::Rays)] +
+                                  thread.counters[static_cast<std::size_t>(Counter::ShadowRays)];
+            const ZoneStats &idle = thread.zones[static_cast<std::size_t>(Zone::Idle)];
+            if (threadRays == 0 && idle.calls == 0) continue;
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%u", thread.thread);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(threadRays));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", idle.milliseconds());
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+} // namespace glpt::profile
@@ -0,0 +1,63 @@
+//
+// Created by taylor-santos on 10/16/2026 at 18:02.
+//
+
+#include "progressive.hpp"
+
+#include <algorithm>
+
+#include "profiler.hpp"
+
+namespace glpt {
+
+ProgressiveRenderer::ProgressiveRenderer(const ProgressiveSettings &settings)
+    : settings_{settings}
+    , framebuffer_{settings.width, settings.height, settings.tileSize} {}
+
+uint64_t
+ProgressiveRenderer::renderPass(const SceneView &scene, ThreadPool &pool) {
+    const TileGrid &grid     = framebuffer_.grid();
+    bool            adaptive = settings_.errorThreshold > 0.0f;
+    uint32_t        minCount = std::max(settings_.minSamples, 2u);
+
+    std::atomic<uint64_t> traced{0};
+    std::atomic<bool>     active{false};
+    pool.parallelFor(grid.count(), [&](uint32_t tile, unsigned) {
+        if (framebuffer_.tileConverged(tile)) return;
+        GLPT_PROFILE_SCOPE(profile::Zone::RenderTile);
+        profile::ZoneAccumulator shade(profile::Zone::Shade);
+        TileRect                 rect    = grid.rect(tile);
+        uint64_t                 samples = 0;
+        for (uint32_t y = rect.y0; y < rect.y1; y++) {
+            for (uint32_t x = rect.x0; x < rect.x1; x++) {
+                PixelAccumulator &acc = framebuffer_.accumulator(x, y);
+                if (acc.converged) continue;
+                uint32_t pixel = y * grid.width + x;
+                for (uint32_t s = 0; s < settings_.samplesPerPass; s++) {
+                    Pcg32 rng = pixelSampler(pixel, acc.count, settings_.seed);
+                    Ray   ray = primaryRay(scene.camera, x, y, grid.width, grid.height, rng);
+                    acc.add(tracePath(scene, ray, rng, settings_.integrator, shade));
+                }
+                samples += settings_.samplesPerPass;
+                acc.converged = adaptive && acc.count >= minCount &&
+                                acc.relativeError() < settings_.errorThreshold;
+            }
+        }
+        framebuffer_.publish(tile);
+        traced.fetch_add(samples, std::memory_order_relaxed);
+        if (!framebuffer_.tileConverged(tile)) active.store(true, std::memory_order_relaxed);
+    });
+
+    passes_.fetch_add(1, std::memory_order_relaxed);
+    converged_.store(adaptive && !active.load(), std::memory_order_relaxed);
+    return traced.load();
+}
+
+void
+ProgressiveRenderer::reset() {
+    framebuffer_.reset();
+    passes_.store(0, std::memory_order_relaxed);
+    converged_.store(false, std::memory_order_relaxed);
+}
+
+} // namespace glpt
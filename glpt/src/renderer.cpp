@@ -0,0 +1,47 @@
+//
+// Created by taylor-santos on 10/16/2026 at 15:21.
+//
+
+#include "renderer.hpp"
+
+#include <algorithm>
+
+#include "profiler.hpp"
+
+namespace glpt {
+
+Image
+render(const SceneView &scene, const RenderSettings &settings, ThreadPool &pool) {
+    Image image;
+    render(scene, settings, pool, image);
+    return image;
+}
+
+void
+render(const SceneView &scene, const RenderSettings &settings, ThreadPool &pool, Image &image) {
+    if (image.width != settings.width || image.height != settings.height) {
+        image = Image(settings.width, settings.height);
+    }
+    TileGrid grid{settings.width, settings.height, std::max(settings.tileSize, 1u)};
+    float    scale = 1.0f / static_cast<float>(std::max(settings.samplesPerPixel, 1u));
+
+    pool.parallelFor(grid.count(), [&](uint32_t tile, unsigned) {
+        GLPT_PROFILE_SCOPE(profile::Zone::RenderTile);
+        profile::ZoneAccumulator shade(profile::Zone::Shade);
+        TileRect                 rect = grid.rect(tile);
+        for (uint32_t y = rect.y0; y < rect.y1; y++) {
+            for (uint32_t x = rect.x0; x < rect.x1; x++) {
+                uint32_t  pixel = y * grid.width + x;
+                glm::vec3 sum{0.0f};
+                for (uint32_t s = 0; s < settings.samplesPerPixel; s++) {
+                    Pcg32 rng = pixelSampler(pixel, s, settings.seed);
+                    Ray   ray = primaryRay(scene.camera, x, y, grid.width, grid.height, rng);
+                    sum += tracePath(scene, ray, rng, settings.integrator, shade);
+                }
+                image.at(x, y) = sum * scale;
+            }
+        }
+    });
+}
+
+} // namespace glpt
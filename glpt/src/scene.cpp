@@ -0,0 +1,49 @@
+//
+// Created by taylor-santos on 10/16/2026 at 14:11.
+//
+
+#include "scene.hpp"
+
+namespace glpt {
+
+uint32_t
+Scene::add(const Mesh &part, const Material &material) {
+    auto firstVertex   = static_cast<uint32_t>(mesh.positions.size());
+    auto firstTriangle = static_cast<uint32_t>(mesh.triangles.size());
+    auto materialIndex = static_cast<uint32_t>(materials.size());
+    materials.push_back(material);
+    mesh.positions.insert(mesh.positions.end(), part.positions.begin(), part.positions.end());
+    for (const auto &tri : part.triangles) {
+        mesh.triangles.push_back(tri + glm::uvec3{firstVertex});
+        triangleMaterials.push_back(materialIndex);
+    }
+    return firstTriangle;
+}
+
+void
+Scene::commit(const BVHBuildOptions &options) {
+    bvh     = BVH::build(mesh.view(), options);
+    wideBvh = NativeBVH::build(bvh.view(), mesh.view());
+    findLights();
+}
+
+void
+Scene::findLights() {
+    lights.clear();
+    for (uint32_t i = 0; i < triangleMaterials.size(); i++) {
+        if (materials[triangleMaterials[i]].isEmissive()) lights.push_back(i);
+    }
+}
+
+BVHUpdate
+Scene::update(const BVHBuildOptions &options) {
+    BVHUpdate result = bvh.update(mesh.view(), options);
+    if (result == BVHUpdate::Rebuild) {
+        wideBvh = NativeBVH::build(bvh.view(), mesh.view());
+    } else {
+        wideBvh.refit(mesh.view());
+    }
+    return result;
+}
+
+} // namespace glpt
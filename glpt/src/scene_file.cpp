@@ -0,0 +1,221 @@
+//
+// Created by taylor-santos on 10/16/2026 at 19:52.
+//
+
+#include "scene_file.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace glpt {
+
+namespace {
+
+static_assert(sizeof(glm::vec3) == 12, "scene files require tightly packed glm vectors");
+static_assert(sizeof(glm::uvec3) == 12, "scene files require tightly packed glm vectors");
+static_assert(std::is_trivially_copyable_v<SceneFileHeader>);
+static_assert(std::is_trivially_copyable_v<Material>);
+static_assert(std::is_trivially_copyable_v<BVHNode>);
+
+constexpr std::size_t
+index(SceneSection section) {
+    return static_cast<std::size_t>(section);
+}
+
+uint64_t
+alignUp(uint64_t offset) {
+    return (offset + SceneFileHeader::alignment - 1) / SceneFileHeader::alignment *
+           SceneFileHeader::alignment;
+}
+
+// Points out at the array a section describes, after checking that it lies inside the file.
+template<typename T>
+void
+mapSection(
+    const std::string     &path,
+    span<const std::byte>  bytes,
+    const SceneFileHeader &header,
+    SceneSection           which,
+    span<const T>         &out) {
+    const SceneFileSection &entry = header.sections[index(which)];
+    uint64_t                size  = bytes.size();
+    if (entry.offset % alignof(T) != 0 || entry.offset > size ||
+        entry.count > (size - entry.offset) / sizeof(T)) {
+        throw std::runtime_error(
+            path + ": section " + std::to_string(index(which)) + " is out of bounds");
+    }
+    out = {reinterpret_cast<const T *>(bytes.data() + entry.offset), entry.count};
+}
+
+// Lays out each array after the header and writes it at its offset.
+class Writer {
+public:
+    explicit Writer(std::ofstream &out)
+        : out_{out} {}
+
+    template<typename T>
+    void
+    add(SceneFileHeader &header, SceneSection section, span<const T> data) {
+        SceneFileSection &entry = header.sections[index(section)];
+        entry.offset            = alignUp(end_);
+        entry.count             = data.size();
+        end_                    = entry.offset + data.size_bytes();
+        chunks_.push_back({entry.offset, as_bytes(data)});
+    }
+
+    void
+    write(const SceneFileHeader &header) {
+        out_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        uint64_t position = sizeof(header);
+        for (const auto &[offset, bytes] : chunks_) {
+            static constexpr char padding[SceneFileHeader::alignment] = {};
+            out_.write(padding, static_cast<std::streamsize>(offset - position));
+            out_.write(
+                reinterpret_cast<const char *>(bytes.data()),
+                static_cast<std::streamsize>(bytes.size()));
+            position = offset + bytes.size();
+        }
+    }
+
+private:
+    struct Chunk {
+        uint64_t              offset;
+        span<const std::byte> bytes;
+    };
+
+    std::ofstream     &out_;
+    uint64_t           end_ = sizeof(SceneFileHeader);
+    std::vector<Chunk> chunks_;
+};
+
+} // namespace
+
+bool
+writeSceneFile(const SceneView &scene, const std::string &path) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) return false;
+
+    SceneFileHeader header{};
+    std::memcpy(header.magic, SceneFileHeader::magicValue, sizeof(header.magic));
+    header.version = SceneFileHeader::currentVersion;
+    header.endian  = SceneFileHeader::endianTag;
+    header.camera  = scene.camera;
+
+    Writer writer(out);
+    writer.add(header, SceneSection::Positions, scene.mesh.positions);
+    writer.add(header, SceneSection::Triangles, scene.mesh.triangles);
+    writer.add(header, SceneSection::Materials, scene.materials);
+    writer.add(header, SceneSection::TriangleMaterials, scene.triangleMaterials);
+    writer.add(header, SceneSection::Lights, scene.lights);
+    writer.add(header, SceneSection::BVHNodes, scene.bvh.nodes);
+    writer.add(header, SceneSection::PrimIndices, scene.bvh.primIndices);
+    writer.write(header);
+    return static_cast<bool>(out.flush());
+}
+
+SceneFile::SceneFile(const std::string &path, const SceneFileOptions &options)
+    : file_{path} {
+    auto bytes = file_.bytes();
+    if (bytes.size() < sizeof(SceneFileHeader)) {
+        throw std::runtime_error(path + ": truncated header");
+    }
+    std::memcpy(&header_, bytes.data(), sizeof(header_));
+    if (std::memcmp(header_.magic, SceneFileHeader::magicValue, sizeof(header_.magic)) != 0) {
+        throw std::runtime_error(path + ": not a glpt scene file");
+    }
+    if (header_.endian != SceneFileHeader::endianTag) {
+        throw std::runtime_error(path + ": written on a machine of different endianness");
+    }
+    if (header_.version != SceneFileHeader::currentVersion) {
+        throw std::runtime_error(
+            path + ": unsupported version " + std::to_string(header_.version) + " (expected " +
+            std::to_string(SceneFileHeader::currentVersion) + ")");
+    }
+
+    mapSection(path, bytes, header_, SceneSection::Positions, view_.mesh.positions);
+    mapSection(path, bytes, header_, SceneSection::Triangles, view_.mesh.triangles);
+    mapSection(path, bytes, header_, SceneSection::Materials, view_.materials);
+    mapSection(path, bytes, header_, SceneSection::TriangleMaterials, view_.triangleMaterials);
+    mapSection(path, bytes, header_, SceneSection::Lights, view_.lights);
+    mapSection(path, bytes, header_, SceneSection::BVHNodes, view_.bvh.nodes);
+    mapSection(path, bytes, header_, SceneSection::PrimIndices, view_.bvh.primIndices);
+    view_.camera = header_.camera;
+
+    std::size_t triangles = view_.mesh.triangles.size();
+    if (view_.triangleMaterials.size() != triangles ||
+        view_.bvh.primIndices.size() != (view_.bvh.nodes.empty() ? 0 : triangles)) {
+        throw std::runtime_error(path + ": section sizes are inconsistent");
+    }
+    if (options.verify) {
+        try {
+            verify();
+        } catch (const std::runtime_error &e) {
+            throw std::runtime_error(path + ": " + e.what());
+        }
+    }
+    if (options.buildWideBvh) {
+        wideBvh_      = NativeBVH::build(view_.bvh, view_.mesh);
+        view_.wideBvh = &wideBvh_;
+    }
+}
+
+void
+SceneFile::verify() const {
+    const SceneView &scene     = view_;
+    auto             fail      = [](const char *what) { throw std::runtime_error(what); };
+    auto             vertices  = scene.mesh.positions.size();
+    auto             triangles = scene.mesh.triangles.size();
+    for (const auto &tri : scene.mesh.triangles) {
+        if (tri.x >= vertices || tri.y >= vertices || tri.z >= vertices) {
+            fail("triangle references a missing vertex");
+        }
+    }
+    for (uint32_t material : scene.triangleMaterials) {
+        if (material >= scene.materials.size()) fail("triangle references a missing material");
+    }
+    for (uint32_t light : scene.lights) {
+        if (light >= triangles) fail("light references a missing triangle");
+    }
+    for (uint32_t prim : scene.bvh.primIndices) {
+        if (prim >= triangles) fail("BVH references a missing triangle");
+    }
+    const auto nodes = scene.bvh.nodes.size();
+    for (std::size_t i = 0; i < nodes; i++) {
+        const BVHNode &node = scene.bvh.nodes[i];
+        if (node.isLeaf()) {
+            if (node.offset > scene.bvh.primIndices.size() ||
+                node.count > scene.bvh.primIndices.size() - node.offset) {
+                fail("BVH leaf is out of bounds");
+            }
+        } else if (node.offset <= i + 1 || node.offset >= nodes) {
+            fail("BVH node is not in depth-first order");
+        }
+    }
+    // Traversal uses a fixed-size stack, so the tree must not be deeper than the builder allows.
+    // Every node must also be reached exactly once: interior nodes sharing a child would make this
+    // walk, and traversal, exponential in the depth.
+    std::vector<std::pair<uint32_t, uint32_t>> stack;
+    std::vector<bool>                          visited(nodes);
+    std::size_t                                reached = 0;
+    if (nodes > 0) stack.emplace_back(0, 1);
+    while (!stack.empty()) {
+        auto [node, depth] = stack.back();
+        stack.pop_back();
+        if (depth > BVHView::maxDepth) fail("BVH is too deep");
+        if (visited[node]) fail("BVH node has more than one parent");
+        visited[node] = true;
+        reached++;
+        if (!scene.bvh.nodes[node].isLeaf()) {
+            stack.emplace_back(node + 1, depth + 1);
+            stack.emplace_back(scene.bvh.nodes[node].offset, depth + 1);
+        }
+    }
+    if (reached != nodes) fail("BVH has unreachable nodes");
+}
+
+} // namespace glpt
@@ -0,0 +1,160 @@
+//
+// Created by taylor-santos on 10/16/2026 at 13:31.
+//
+
+#include "thread_pool.hpp"
+
+#include <algorithm>
+
+#include "profiler.hpp"
+
+namespace glpt {
+
+namespace {
+
+constexpr uint64_t
+pack(uint32_t begin, uint32_t end) {
+    return (static_cast<uint64_t>(begin) << 32u) | end;
+}
+
+constexpr uint32_t
+rangeBegin(uint64_t range) {
+    return static_cast<uint32_t>(range >> 32u);
+}
+
+constexpr uint32_t
+rangeEnd(uint64_t range) {
+    return static_cast<uint32_t>(range);
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(unsigned threadCount)
+    : workerCount_{threadCount ? threadCount : std::max(1u, std::thread::hardware_concurrency())}
+    , queues_{std::make_unique<Queue[]>(workerCount_)} {
+    threads_.reserve(workerCount_ - 1);
+    for (unsigned worker = 1; worker < workerCount_; worker++) {
+        threads_.emplace_back([this, worker] { workerLoop(worker); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto &thread : threads_) {
+        thread.join();
+    }
+}
+
+void
+ThreadPool::run(uint32_t count, TaskFn fn, void *ctx) {
+    if (count == 0) return;
+    if (workerCount_ == 1) {
+        for (uint32_t task = 0; task < count; task++) {
+            fn(ctx, task, 0);
+        }
+        return;
+    }
+
+    // Split the tasks into contiguous, nearly equal ranges before waking anyone up.
+    for (unsigned worker = 0; worker < workerCount_; worker++) {
+        auto begin = static_cast<uint32_t>(uint64_t{count} * worker / workerCount_);
+        auto end   = static_cast<uint32_t>(uint64_t{count} * (worker + 1) / workerCount_);
+        queues_[worker].range.store(pack(begin, end), std::memory_order_relaxed);
+    }
+    uint64_t generation;
+    {
+        std::lock_guard lock(mutex_);
+        fn_        = fn;
+        ctx_       = ctx;
+        busy_      = workerCount_;
+        generation = ++generation_;
+    }
+    wake_.notify_all();
+
+    drain(0);
+    finish(0, generation);
+}
+
+void
+ThreadPool::workerLoop(unsigned worker) {
+    // Claim the profiling record now: the first idle zone is only recorded once run() may have
+    // returned, and claiming a record allocates.
+    if constexpr (profile::enabled) static_cast<void>(profile::detail::threadRecord());
+    uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock lock(mutex_);
+            wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) return;
+            seen = generation_;
+        }
+        drain(worker);
+        finish(worker, seen);
+    }
+}
+
+void
+ThreadPool::finish(unsigned worker, uint64_t generation) {
+    GLPT_PROFILE_SCOPE(profile::Zone::Idle);
+    std::unique_lock lock(mutex_);
+    if (--busy_ == 0) {
+        lock.unlock();
+        done_.notify_all();
+        return;
+    }
+    // The caller of run() has to wait for everyone. The other workers only wait when profiling,
+    // so that the time they spend without work is recorded as idle time.
+    if (worker == 0 || profile::enabled) {
+        done_.wait(lock, [&] { return busy_ == 0 || generation_ != generation; });
+    }
+}
+
+void
+ThreadPool::drain(unsigned worker) {
+    uint32_t task;
+    while (popFront(worker, task)) {
+        fn_(ctx_, task, worker);
+    }
+    // Out of local work: steal from the others, starting with the next worker so that thieves
+    // spread out instead of all hitting worker 0.
+    for (unsigned i = 1; i < workerCount_; i++) {
+        unsigned victim = (worker + i) % workerCount_;
+        while (stealBack(victim, task)) {
+            fn_(ctx_, task, worker);
+        }
+    }
+}
+
+bool
+ThreadPool::popFront(unsigned worker, uint32_t &task) {
+    auto    &range   = queues_[worker].range;
+    uint64_t current = range.load(std::memory_order_relaxed);
+    while (rangeBegin(current) < rangeEnd(current)) {
+        uint64_t next = pack(rangeBegin(current) + 1, rangeEnd(current));
+        if (range.compare_exchange_weak(current, next, std::memory_order_relaxed)) {
+            task = rangeBegin(current);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+ThreadPool::stealBack(unsigned victim, uint32_t &task) {
+    auto    &range   = queues_[victim].range;
+    uint64_t current = range.load(std::memory_order_relaxed);
+    while (rangeBegin(current) < rangeEnd(current)) {
+        uint64_t next = pack(rangeBegin(current), rangeEnd(current) - 1);
+        if (range.compare_exchange_weak(current, next, std::memory_order_relaxed)) {
+            task = rangeEnd(current) - 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace glpt
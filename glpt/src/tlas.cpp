@@ -0,0 +1,139 @@
+//
+// Created by taylor-santos on 10/16/2026 at 23:55.
+//
+
+#include "tlas.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "profiler.hpp"
+
+namespace glpt {
+
+namespace {
+
+AABB
+transformBounds(const AABB &box, const glm::mat4 &transform) {
+    AABB result;
+    for (int i = 0; i < 8; i++) {
+        glm::vec3 corner{
+            (i & 1) ? box.max.x : box.min.x,
+            (i & 2) ? box.max.y : box.min.y,
+            (i & 4) ? box.max.z : box.min.z};
+        result.grow(glm::vec3(transform * glm::vec4(corner, 1.0f)));
+    }
+    return result;
+}
+
+} // namespace
+
+TLAS
+TLAS::build(
+    std::vector<BLASView>  blases,
+    std::vector<Instance>  instances,
+    const BVHBuildOptions &options) {
+    TLAS tlas;
+    tlas.blases_    = std::move(blases);
+    tlas.instances_ = std::move(instances);
+    tlas.options_   = options;
+    tlas.worldToObject_.reserve(tlas.instances_.size());
+    for (const auto &instance : tlas.instances_) {
+        tlas.worldToObject_.push_back(glm::inverse(instance.transform));
+    }
+    tlas.instanceBounds_.resize(tlas.instances_.size());
+    tlas.computeBounds();
+    tlas.bvh_ = BVH::build(tlas.instanceBounds_, options);
+    return tlas;
+}
+
+void
+TLAS::setTransform(uint32_t instance, const glm::mat4 &transform) {
+    instances_[instance].transform = transform;
+    worldToObject_[instance]       = glm::inverse(transform);
+}
+
+void
+TLAS::setBLAS(uint32_t blas, const BLASView &view) {
+    blases_[blas] = view;
+}
+
+BVHUpdate
+TLAS::update() {
+    computeBounds();
+    return bvh_.update(instanceBounds_, options_);
+}
+
+void
+TLAS::computeBounds() {
+    for (std::size_t i = 0; i < instances_.size(); i++) {
+        const Instance &instance = instances_[i];
+        const BVHView  &blas     = blases_[instance.blas].bvh;
+        if (blas.empty()) {
+            // Nothing to hit, but the builder still needs a finite box to bin. Use the origin of
+            // the instance.
+            instanceBounds_[i] = {};
+            instanceBounds_[i].grow(glm::vec3(instance.transform[3]));
+        } else {
+            instanceBounds_[i] = transformBounds(blas.nodes[0].bounds(), instance.transform);
+        }
+    }
+}
+
+template<bool AnyHit>
+bool
+TLAS::traverse(const Ray &ray, float tMax, InstanceHit &hit) const {
+    profile::TraversalCounter counter(AnyHit);
+    return bvh_.view().traverse<AnyHit>(
+        ray, tMax, counter, [&](const BVHNode &leaf, float &leafTMax) {
+            bool found = false;
+            for (uint32_t i = leaf.offset; i < leaf.offset + leaf.count; i++) {
+                uint32_t         instance      = bvh_.primIndices()[i];
+                const BLASView  &blas          = blases_[instances_[instance].blas];
+                const glm::mat4 &worldToObject = worldToObject_[instance];
+                // The direction is deliberately left unnormalized so that distances along the
+                // object space ray are the same as along the world space one.
+                Ray local = ray;
+                local.origin    = glm::vec3(worldToObject * glm::vec4(ray.origin, 1.0f));
+                local.direction = glm::vec3(worldToObject * glm::vec4(ray.direction, 0.0f));
+                Hit &closest    = hit;
+                bool hitBlas    = blas.bvh.traverse<AnyHit>(
+                    local, leafTMax, counter, [&](const BVHNode &blasLeaf, float &blasTMax) {
+                        counter.testTriangles(blasLeaf.count);
+                        return blas.bvh.intersectLeaf<AnyHit>(
+                            blasLeaf, local, blas.mesh, blasTMax, closest);
+                    });
+                if (!hitBlas) continue;
+                if constexpr (AnyHit) return true;
+                leafTMax     = hit.t;
+                hit.instance = instance;
+                found        = true;
+            }
+            return found;
+        });
+}
+
+bool
+TLAS::intersect(const Ray &ray, InstanceHit &hit) const {
+    return traverse<false>(ray, std::min(ray.tMax, hit.t), hit);
+}
+
+bool
+TLAS::occluded(const Ray &ray) const {
+    InstanceHit hit;
+    return traverse<true>(ray, ray.tMax, hit);
+}
+
+glm::vec3
+TLAS::normal(const InstanceHit &hit) const {
+    glm::vec3 n = triangleNormal(blases_[instances_[hit.instance].blas].mesh, hit.prim);
+    // Normals transform by the inverse transpose. The rows of the transposed inverse are the
+    // columns of the inverse.
+    const glm::mat4 &inverse = worldToObject_[hit.instance];
+    return {
+        glm::dot(glm::vec3(inverse[0]), n),
+        glm::dot(glm::vec3(inverse[1]), n),
+        glm::dot(glm::vec3(inverse[2]), n)};
+}
+
+} // namespace glpt
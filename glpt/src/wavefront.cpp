@@ -0,0 +1,297 @@
+//
+// Created by taylor-santos on 10/16/2026 at 19:42.
+//
+
+#include "wavefront.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "integrator.hpp"
+#include "profiler.hpp"
+#include "sampling.hpp"
+
+namespace glpt {
+
+namespace {
+
+// Queue entries handed to a worker at a time by the parallel stages.
+constexpr uint32_t chunkSize = 256;
+
+// Continuation rays are binned by the cube face their direction points through and a 4x4 grid
+// on that face.
+constexpr uint32_t directionBins = 6 * 4 * 4;
+
+template<typename Fn>
+void
+forEachChunked(ThreadPool &pool, uint32_t count, const Fn &fn) {
+    if (count == 0) return;
+    pool.parallelFor((count + chunkSize - 1) / chunkSize, [&](uint32_t task, unsigned) {
+        uint32_t end = std::min(count, (task + 1) * chunkSize);
+        for (uint32_t i = task * chunkSize; i < end; i++) {
+            fn(i);
+        }
+    });
+}
+
+uint32_t
+gridCell(float coordinate) {
+    return std::min(static_cast<uint32_t>((coordinate + 1.0f) * 2.0f), 3u);
+}
+
+uint32_t
+directionBin(const glm::vec3 &d) {
+    glm::vec3 a = glm::abs(d);
+    uint32_t  face;
+    float     s, t;
+    if (a.x >= a.y && a.x >= a.z) {
+        face = d.x < 0.0f ? 1 : 0;
+        s    = d.y / a.x;
+        t    = d.z / a.x;
+    } else if (a.y >= a.z) {
+        face = d.y < 0.0f ? 3 : 2;
+        s    = d.x / a.y;
+        t    = d.z / a.y;
+    } else {
+        face = d.z < 0.0f ? 5 : 4;
+        s    = d.x / a.z;
+        t    = d.y / a.z;
+    }
+    return face * 16 + gridCell(s) * 4 + gridCell(t);
+}
+
+} // namespace
+
+WavefrontRenderer::WavefrontRenderer(const WavefrontOptions &options)
+    : options_{options} {}
+
+void
+WavefrontRenderer::allocate(uint32_t paths, uint32_t bucketCount) {
+    arena_.reset();
+    origin_          = arena_.allocate<glm::vec3>(paths);
+    direction_       = arena_.allocate<glm::vec3>(paths);
+    throughput_      = arena_.allocate<glm::vec3>(paths);
+    radiance_        = arena_.allocate<glm::vec3>(paths);
+    rng_             = arena_.allocate<Pcg32>(paths, Pcg32(0));
+    hitT_            = arena_.allocate<float>(paths);
+    hitPrim_         = arena_.allocate<uint32_t>(paths);
+    hitInstance_     = arena_.allocate<uint32_t>(paths);
+    alive_           = arena_.allocate<uint8_t>(paths);
+    shadowDirection_ = arena_.allocate<glm::vec3>(paths);
+    shadowDistance_  = arena_.allocate<float>(paths);
+    shadowWeight_    = arena_.allocate<glm::vec3>(paths);
+    active_          = arena_.allocate<uint32_t>(paths);
+    shadow_          = arena_.allocate<uint32_t>(paths);
+    scratch_         = arena_.allocate<uint32_t>(paths);
+    buckets_         = arena_.allocate<uint32_t>(bucketCount + 1);
+}
+
+template<typename Key>
+void
+WavefrontRenderer::sortQueue(
+    span<uint32_t> queue,
+    uint32_t       count,
+    uint32_t       bucketCount,
+    Key            key) {
+    GLPT_PROFILE_SCOPE(profile::Zone::WavefrontSort);
+    std::fill(buckets_.begin(), buckets_.begin() + bucketCount + 1, 0);
+    for (uint32_t i = 0; i < count; i++) {
+        buckets_[key(queue[i]) + 1]++;
+    }
+    for (uint32_t b = 1; b <= bucketCount; b++) {
+        buckets_[b] += buckets_[b - 1];
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        scratch_[buckets_[key(queue[i])]++] = queue[i];
+    }
+    std::copy(scratch_.begin(), scratch_.begin() + count, queue.begin());
+}
+
+void
+WavefrontRenderer::generate(
+    const SceneView      &scene,
+    const RenderSettings &settings,
+    ThreadPool           &pool,
+    uint32_t              firstPixel,
+    uint32_t              paths) {
+    GLPT_PROFILE_SCOPE(profile::Zone::WavefrontGenerate);
+    uint32_t spp = settings.samplesPerPixel;
+    forEachChunked(pool, paths, [&](uint32_t path) {
+        uint32_t pixel = firstPixel + path / spp;
+        Pcg32    rng   = pixelSampler(pixel, path % spp, settings.seed);
+        Ray      ray   = primaryRay(
+            scene.camera,
+            pixel % settings.width,
+            pixel / settings.width,
+            settings.width,
+            settings.height,
+            rng);
+        origin_[path]     = ray.origin;
+        direction_[path]  = ray.direction;
+        throughput_[path] = glm::vec3{1.0f};
+        radiance_[path]   = glm::vec3{0.0f};
+        rng_[path]        = rng;
+        active_[path]     = path;
+    });
+}
+
+void
+WavefrontRenderer::extend(const SceneView &scene, ThreadPool &pool, uint32_t count) {
+    GLPT_PROFILE_SCOPE(profile::Zone::WavefrontExtend);
+    forEachChunked(pool, count, [&](uint32_t i) {
+        uint32_t    path = active_[i];
+        InstanceHit hit;
+        scene.intersect({origin_[path], direction_[path]}, hit);
+        hitT_[path]        = hit.t;
+        hitPrim_[path]     = hit.prim;
+        hitInstance_[path] = hit.instance;
+    });
+}
+
+void
+WavefrontRenderer::shade(
+    const SceneView          &scene,
+    const IntegratorSettings &settings,
+    ThreadPool               &pool,
+    uint32_t                  count,
+    uint32_t                  bounce) {
+    GLPT_PROFILE_SCOPE(profile::Zone::WavefrontShade);
+    // Mirrors one iteration of tracePath, except that the light sample is queued for the connect
+    // stage instead of being traced immediately.
+    forEachChunked(pool, count, [&](uint32_t i) {
+        uint32_t path       = active_[i];
+        alive_[path]        = 0;
+        shadowWeight_[path] = glm::vec3{0.0f};
+        InstanceHit hit;
+        hit.prim     = hitPrim_[path];
+        hit.instance = hitInstance_[path];
+        if (!hit.valid()) return;
+
+        const Material &material   = scene.materialOf(hit);
+        glm::vec3       direction  = direction_[path];
+        glm::vec3      &throughput = throughput_[path];
+        glm::vec3       normal     = glm::normalize(scene.normal(hit));
+        bool            front      = glm::dot(normal, direction) < 0.0f;
+        if (bounce == 0 && front) radiance_[path] += throughput * material.emission;
+        if (bounce == settings.maxBounces) return;
+
+        if (!front) normal = -normal;
+        Pcg32    &rng   = rng_[path];
+        glm::vec3 point = origin_[path] + direction * hitT_[path] + normal * rayEpsilon;
+
+        LightSample light      = sampleLight(scene, point, rng);
+        float       cosSurface = glm::dot(normal, light.direction);
+        if (cosSurface > 0.0f && light.weight != glm::vec3{0.0f}) {
+            shadowDirection_[path] = light.direction;
+            shadowDistance_[path]  = light.distance * (1.0f - rayEpsilon);
+            shadowWeight_[path] = throughput * material.albedo * light.weight * (cosSurface / pi);
+        }
+
+        float u1         = rng.nextFloat();
+        float u2         = rng.nextFloat();
+        origin_[path]    = point;
+        direction_[path] = sampleCosineHemisphere(normal, u1, u2);
+        throughput *= material.albedo;
+
+        if (bounce + 1 >= settings.rouletteDepth) {
+            float maxComponent = std::max(throughput.x, std::max(throughput.y, throughput.z));
+            float survive      = std::min(maxComponent, 0.95f);
+            if (rng.nextFloat() >= survive) return;
+            throughput /= survive;
+        }
+        alive_[path] = 1;
+    });
+}
+
+void
+WavefrontRenderer::connect(const SceneView &scene, ThreadPool &pool, uint32_t count) {
+    GLPT_PROFILE_SCOPE(profile::Zone::WavefrontConnect);
+    forEachChunked(pool, count, [&](uint32_t i) {
+        uint32_t path = shadow_[i];
+        // The continuation ray already replaced the path's ray, but it starts at the shading
+        // point, which is also where the shadow ray starts.
+        Ray shadow{origin_[path], shadowDirection_[path], 0.0f, shadowDistance_[path]};
+        if (!scene.occluded(shadow)) radiance_[path] += shadowWeight_[path];
+    });
+}
+
+Image
+WavefrontRenderer::render(
+    const SceneView      &scene,
+    const RenderSettings &settings,
+    ThreadPool           &pool) {
+    Image image;
+    render(scene, settings, pool, image);
+    return image;
+}
+
+void
+WavefrontRenderer::render(
+    const SceneView      &scene,
+    const RenderSettings &settings,
+    ThreadPool           &pool,
+    Image                &image) {
+    if (image.width != settings.width || image.height != settings.height) {
+        image = Image(settings.width, settings.height);
+    }
+    if (settings.samplesPerPixel == 0) {
+        std::fill(image.pixels.begin(), image.pixels.end(), glm::vec3{0.0f});
+        return;
+    }
+
+    uint32_t spp           = settings.samplesPerPixel;
+    uint32_t pixelCount    = settings.width * settings.height;
+    uint32_t waveWidth     = std::max(options_.batchSize / spp, 1u);
+    float    scale         = 1.0f / static_cast<float>(spp);
+    auto     materialCount = static_cast<uint32_t>(scene.materials.size());
+    allocate(std::min(waveWidth, pixelCount) * spp, std::max(materialCount + 1, directionBins));
+
+    for (uint32_t firstPixel = 0; firstPixel < pixelCount; firstPixel += waveWidth) {
+        uint32_t pixels = std::min(waveWidth, pixelCount - firstPixel);
+        uint32_t count  = pixels * spp;
+        generate(scene, settings, pool, firstPixel, count);
+
+        for (uint32_t bounce = 0; count > 0; bounce++) {
+            extend(scene, pool, count);
+            if (options_.sortQueues) {
+                // Misses go to bucket 0 so that shading runs over one material at a time.
+                sortQueue(active_, count, materialCount + 1, [&](uint32_t path) {
+                    InstanceHit hit;
+                    hit.prim     = hitPrim_[path];
+                    hit.instance = hitInstance_[path];
+                    return hit.valid() ? scene.materialIndex(hit) + 1 : 0;
+                });
+            }
+            shade(scene, settings.integrator, pool, count, bounce);
+
+            // Split the survivors into the shadow queue and the next extension queue. Compacting
+            // in place is safe because an entry never moves forward.
+            uint32_t shadows = 0;
+            uint32_t next    = 0;
+            for (uint32_t i = 0; i < count; i++) {
+                uint32_t path = active_[i];
+                if (shadowWeight_[path] != glm::vec3{0.0f}) shadow_[shadows++] = path;
+                if (alive_[path]) active_[next++] = path;
+            }
+            if (options_.sortQueues) {
+                sortQueue(active_, next, directionBins, [&](uint32_t path) {
+                    return directionBin(direction_[path]);
+                });
+            }
+            connect(scene, pool, shadows);
+            count = next;
+        }
+
+        // Sum each pixel's samples in sample order, exactly as render() does.
+        forEachChunked(pool, pixels, [&](uint32_t local) {
+            uint32_t  pixel = firstPixel + local;
+            glm::vec3 sum{0.0f};
+            for (uint32_t s = 0; s < spp; s++) {
+                sum += radiance_[local * spp + s];
+            }
+            image.at(pixel % settings.width, pixel / settings.width) = sum * scale;
+        });
+    }
+}
+
+} // namespace glpt
@@ -0,0 +1,316 @@
+//
+// Created by taylor-santos on 10/16/2026 at 17:58.
+//
+
+#include "wide_bvh.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "profiler.hpp"
+
+namespace glpt {
+
+template<int W>
+WideBVH<W>
+WideBVH<W>::build(const BVHView &bvh, const MeshView &mesh) {
+    GLPT_PROFILE_SCOPE(profile::Zone::WideBVHBuild);
+    WideBVH wide;
+    if (bvh.empty()) return wide;
+    wide.nodes_.reserve(bvh.nodes.size() / (W - 1) + 1);
+    wide.packets_.reserve(bvh.primIndices.size() / W * 2 + 1);
+    wide.collapse(bvh, mesh, 0);
+    return wide;
+}
+
+template<int W>
+uint32_t
+WideBVH<W>::collapse(const BVHView &bvh, const MeshView &mesh, uint32_t binaryNode) {
+    // Pull the binary subtree up into at most W children, always opening the interior child with
+    // the largest surface area since it is the most likely to be visited.
+    uint32_t children[W];
+    uint32_t childCount = 0;
+    children[childCount++] = binaryNode;
+    while (childCount < W) {
+        int   best     = -1;
+        float bestArea = -1.0f;
+        for (uint32_t i = 0; i < childCount; i++) {
+            const BVHNode &node = bvh.nodes[children[i]];
+            float          area = node.bounds().halfArea();
+            if (!node.isLeaf() && area > bestArea) {
+                best     = static_cast<int>(i);
+                bestArea = area;
+            }
+        }
+        if (best < 0) break;
+        uint32_t opened        = children[best];
+        children[best]         = opened + 1;
+        children[childCount++] = bvh.nodes[opened].offset;
+    }
+
+    auto index = static_cast<uint32_t>(nodes_.size());
+    nodes_.emplace_back();
+    {
+        WideNode<W> &node = nodes_[index];
+        std::fill_n(node.minX, W, std::numeric_limits<float>::infinity());
+        std::fill_n(node.minY, W, std::numeric_limits<float>::infinity());
+        std::fill_n(node.minZ, W, std::numeric_limits<float>::infinity());
+        // Empty slots get min == max == +inf. That alone doesn't keep rays out: with tMax = inf
+        // the slab test can still pass, so traversal must keep skipping emptyChild explicitly.
+        std::fill_n(node.maxX, W, std::numeric_limits<float>::infinity());
+        std::fill_n(node.maxY, W, std::numeric_limits<float>::infinity());
+        std::fill_n(node.maxZ, W, std::numeric_limits<float>::infinity());
+        std::fill_n(node.child, W, WideNode<W>::emptyChild);
+        std::fill_n(node.packetCount, W, 0u);
+    }
+    for (uint32_t i = 0; i < childCount; i++) {
+        const BVHNode &child = bvh.nodes[children[i]];
+        uint32_t       target;
+        uint32_t       packets = 0;
+        if (child.isLeaf()) {
+            target  = WideNode<W>::leafFlag | addPackets(bvh, mesh, child);
+            packets = (child.count + W - 1) / W;
+        } else {
+            target = collapse(bvh, mesh, children[i]);
+        }
+        // Recursion may have grown nodes_, so look the node up again.
+        WideNode<W> &node     = nodes_[index];
+        node.minX[i]          = child.min.x;
+        node.minY[i]          = child.min.y;
+        node.minZ[i]          = child.min.z;
+        node.maxX[i]          = child.max.x;
+        node.maxY[i]          = child.max.y;
+        node.maxZ[i]          = child.max.z;
+        node.child[i]         = target;
+        node.packetCount[i]   = packets;
+    }
+    return index;
+}
+
+template<int W>
+uint32_t
+WideBVH<W>::addPackets(const BVHView &bvh, const MeshView &mesh, const BVHNode &leaf) {
+    auto first = static_cast<uint32_t>(packets_.size());
+    for (uint32_t begin = 0; begin < leaf.count; begin += W) {
+        TrianglePacket<W> &packet = packets_.emplace_back();
+        for (uint32_t lane = 0; lane < W; lane++) {
+            uint32_t prim = Hit::invalid;
+            if (begin + lane < leaf.count) prim = bvh.primIndices[leaf.offset + begin + lane];
+            loadTriangle(packet, lane, mesh, prim);
+        }
+    }
+    return first;
+}
+
+template<int W>
+void
+WideBVH<W>::loadTriangle(
+    TrianglePacket<W> &packet,
+    uint32_t           lane,
+    const MeshView    &mesh,
+    uint32_t           prim) {
+    glm::vec3 v0{0.0f}, e1{0.0f}, e2{0.0f};
+    if (prim != Hit::invalid) {
+        const glm::uvec3 &tri = mesh.triangles[prim];
+        v0                    = mesh.positions[tri.x];
+        e1                    = mesh.positions[tri.y] - v0;
+        e2                    = mesh.positions[tri.z] - v0;
+    }
+    for (int axis = 0; axis < 3; axis++) {
+        packet.v0[axis][lane] = v0[axis];
+        packet.e1[axis][lane] = e1[axis];
+        packet.e2[axis][lane] = e2[axis];
+    }
+    packet.prim[lane] = prim;
+}
+
+template<int W>
+void
+WideBVH<W>::refit(const MeshView &mesh) {
+    GLPT_PROFILE_SCOPE(profile::Zone::WideBVHRefit);
+    for (auto &packet : packets_) {
+        for (uint32_t lane = 0; lane < W; lane++) {
+            loadTriangle(packet, lane, mesh, packet.prim[lane]);
+        }
+    }
+    // collapse() appends a node before any of its descendants, so walking backwards visits the
+    // children of a node before the node itself.
+    for (std::size_t i = nodes_.size(); i-- > 0;) {
+        WideNode<W> &node = nodes_[i];
+        for (uint32_t slot = 0; slot < W; slot++) {
+            uint32_t child = node.child[slot];
+            if (child == WideNode<W>::emptyChild) continue;
+            AABB bounds;
+            if (child & WideNode<W>::leafFlag) {
+                uint32_t first = child & ~WideNode<W>::leafFlag;
+                for (uint32_t p = first; p < first + node.packetCount[slot]; p++) {
+                    for (uint32_t prim : packets_[p].prim) {
+                        if (prim != Hit::invalid) bounds.grow(mesh.triangleBounds(prim));
+                    }
+                }
+            } else {
+                const WideNode<W> &inner = nodes_[child];
+                for (uint32_t c = 0; c < W; c++) {
+                    if (inner.child[c] == WideNode<W>::emptyChild) continue;
+                    bounds.grow(glm::vec3{inner.minX[c], inner.minY[c], inner.minZ[c]});
+                    bounds.grow(glm::vec3{inner.maxX[c], inner.maxY[c], inner.maxZ[c]});
+                }
+            }
+            node.minX[slot] = bounds.min.x;
+            node.minY[slot] = bounds.min.y;
+            node.minZ[slot] = bounds.min.z;
+            node.maxX[slot] = bounds.max.x;
+            node.maxY[slot] = bounds.max.y;
+            node.maxZ[slot] = bounds.max.z;
+        }
+    }
+}
+
+template<int W>
+template<bool AnyHit>
+bool
+WideBVH<W>::traverse(const Ray &ray, float tMax, Hit &hit) const {
+    using F = simd::Float<W>;
+    if (nodes_.empty()) return false;
+    profile::TraversalCounter counter(AnyHit);
+
+    const F ox = simd::splat<W>(ray.origin.x);
+    const F oy = simd::splat<W>(ray.origin.y);
+    const F oz = simd::splat<W>(ray.origin.z);
+    const F dx = simd::splat<W>(ray.direction.x);
+    const F dy = simd::splat<W>(ray.direction.y);
+    const F dz = simd::splat<W>(ray.direction.z);
+    const F ix = simd::splat<W>(1.0f / ray.direction.x);
+    const F iy = simd::splat<W>(1.0f / ray.direction.y);
+    const F iz = simd::splat<W>(1.0f / ray.direction.z);
+    const F tMin   = simd::splat<W>(ray.tMin);
+    const F zero   = simd::splat<W>(0.0f);
+    const F one    = simd::splat<W>(1.0f);
+    const F epsPos = simd::splat<W>(1e-9f);
+    const F epsNeg = simd::splat<W>(-1e-9f);
+
+    struct Entry {
+        uint32_t node;
+        float    tNear;
+    };
+    // Each level of the binary tree adds at most one wide level, and each wide level pushes at
+    // most W - 1 siblings.
+    Entry    stack[BVHView::maxDepth * (W - 1) + 1];
+    uint32_t stackSize = 0;
+    stack[stackSize++] = {0, ray.tMin};
+    bool found         = false;
+
+    while (stackSize > 0) {
+        Entry entry = stack[--stackSize];
+        if (entry.tNear > tMax) continue;
+        const WideNode<W> &node = nodes_[entry.node];
+        counter.visitNode();
+
+        F    tHigh = simd::splat<W>(tMax);
+        F    t0x   = (simd::load<W>(node.minX) - ox) * ix;
+        F    t1x   = (simd::load<W>(node.maxX) - ox) * ix;
+        F    t0y   = (simd::load<W>(node.minY) - oy) * iy;
+        F    t1y   = (simd::load<W>(node.maxY) - oy) * iy;
+        F    t0z   = (simd::load<W>(node.minZ) - oz) * iz;
+        F    t1z   = (simd::load<W>(node.maxZ) - oz) * iz;
+        F    enter = simd::max(
+            simd::max(simd::min(t0x, t1x), simd::min(t0y, t1y)),
+            simd::max(simd::min(t0z, t1z), tMin));
+        F    exit  = simd::min(
+            simd::min(simd::max(t0x, t1x), simd::max(t0y, t1y)),
+            simd::min(simd::max(t0z, t1z), tHigh));
+        uint32_t mask = simd::bits(enter <= exit);
+        if (mask == 0) continue;
+
+        float enterLanes[W];
+        simd::store(enter, enterLanes);
+
+        // Leaves are intersected right away so that tMax shrinks before any sibling is pushed.
+        // Interior children are pushed farthest first so the nearest one is popped next.
+        Entry    interior[W];
+        uint32_t interiorCount = 0;
+        for (; mask != 0; mask &= mask - 1) {
+            uint32_t lane  = simd::lowestLane(mask);
+            uint32_t child = node.child[lane];
+            // Needed for correctness, not just speed: see the note on empty slots in collapse().
+            if (child == WideNode<W>::emptyChild) continue;
+            if (!(child & WideNode<W>::leafFlag)) {
+                // Insertion sort by descending distance; there are at most W entries.
+                uint32_t slot = interiorCount++;
+                for (; slot > 0 && interior[slot - 1].tNear < enterLanes[lane]; slot--) {
+                    interior[slot] = interior[slot - 1];
+                }
+                interior[slot] = {child, enterLanes[lane]};
+                continue;
+            }
+            uint32_t first = child & ~WideNode<W>::leafFlag;
+            for (uint32_t p = first; p < first + node.packetCount[lane]; p++) {
+                const TrianglePacket<W> &packet = packets_[p];
+                counter.testTriangles(W);
+
+                F e1x = simd::load<W>(packet.e1[0]);
+                F e1y = simd::load<W>(packet.e1[1]);
+                F e1z = simd::load<W>(packet.e1[2]);
+                F e2x = simd::load<W>(packet.e2[0]);
+                F e2y = simd::load<W>(packet.e2[1]);
+                F e2z = simd::load<W>(packet.e2[2]);
+                F px  = dy * e2z - dz * e2y;
+                F py  = dz * e2x - dx * e2z;
+                F pz  = dx * e2y - dy * e2x;
+                F det = e1x * px + e1y * py + e1z * pz;
+                F inv = one / det;
+                F sx  = ox - simd::load<W>(packet.v0[0]);
+                F sy  = oy - simd::load<W>(packet.v0[1]);
+                F sz  = oz - simd::load<W>(packet.v0[2]);
+                F u   = (sx * px + sy * py + sz * pz) * inv;
+                F qx  = sy * e1z - sz * e1y;
+                F qy  = sz * e1x - sx * e1z;
+                F qz  = sx * e1y - sy * e1x;
+                F v   = (dx * qx + dy * qy + dz * qz) * inv;
+                F t   = (e2x * qx + e2y * qy + e2z * qz) * inv;
+
+                auto valid = ((det > epsPos) | (det < epsNeg)) & (u >= zero) & (v >= zero) &
+                             (u + v <= one) & (t > tMin) & (t < simd::splat<W>(tMax));
+                uint32_t hits = simd::bits(valid);
+                if (hits == 0) continue;
+                if constexpr (AnyHit) return true;
+
+                float tLanes[W], uLanes[W], vLanes[W];
+                simd::store(t, tLanes);
+                simd::store(u, uLanes);
+                simd::store(v, vLanes);
+                for (; hits != 0; hits &= hits - 1) {
+                    auto hitLane = simd::lowestLane(hits);
+                    if (tLanes[hitLane] < tMax) {
+                        tMax  = tLanes[hitLane];
+                        hit   = {tMax, uLanes[hitLane], vLanes[hitLane], packet.prim[hitLane]};
+                        found = true;
+                    }
+                }
+            }
+        }
+
+        for (uint32_t i = 0; i < interiorCount; i++) {
+            stack[stackSize++] = interior[i];
+        }
+    }
+    return found;
+}
+
+template<int W>
+bool
+WideBVH<W>::intersect(const Ray &ray, Hit &hit) const {
+    return traverse<false>(ray, std::min(ray.tMax, hit.t), hit);
+}
+
+template<int W>
+bool
+WideBVH<W>::occluded(const Ray &ray) const {
+    Hit hit;
+    return traverse<true>(ray, ray.tMax, hit);
+}
+
+template class WideBVH<4>;
+template class WideBVH<8>;
+
+} // namespace glpt
@@ -2,11 +2,270 @@
 // Created by taylor-santos on 4/16/2022 at 22:31.
 //
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
 #include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
 
-#include "glpt.hpp"
+#include "procedural.hpp"
+#include "profiler.hpp"
+#include "renderer.hpp"
+#include "scene_file.hpp"
+#include "viewer.hpp"
+#include "wavefront.hpp"
+
+namespace {
+
+struct Options {
+    bool                 help      = false;
+    bool                 headless  = false;
+    bool                 wavefront = false;
+    bool                 profile   = false;
+    glpt::RenderSettings render;
+    unsigned             maxThreads = 0;
+    uint32_t             instances  = 0;
+    std::string          output;
+    std::string          scene;
+    std::string          trace;
+};
+
+void
+usage(std::ostream &out, const char *program) {
+    out << "usage: " << program << " [--headless] [options]\n"
+        << "Opens a window that shows the image converging, unless --headless is given.\n"
+        << "  -h, --help       print this message and exit\n"
+        << "  --headless       render on the CPU without a window and report throughput\n"
+        << "  --width N        image width (default 512)\n"
+        << "  --height N       image height (default 512)\n"
+        << "  --spp N          samples per pixel (default 16)\n"
+        << "  --threads N      render threads, or with --headless the highest thread count to\n"
+        << "                   measure (default: all cores)\n"
+        << "  --output FILE    write the rendered image as a PPM (the viewer writes it on exit)\n"
+        << "  --scene FILE     render a .glpt scene instead of the Cornell box\n"
+        << "  --instances N    add N cubes to the Cornell box as instances in a TLAS\n"
+        << "  --wavefront      use the wavefront integrator instead of the megakernel\n"
+        << "  --profile        print where the time went in the last run, or in the viewer show\n"
+        << "                   the last pass in an overlay (toggled with P)\n"
+        << "  --trace FILE     write the last run as a Chrome trace (chrome://tracing)\n";
+}
+
+bool
+parseArgs(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto        next = [&]() -> const char * { return i + 1 < argc ? argv[++i] : nullptr; };
+        auto        number = [&](uint32_t &value) {
+            const char *text = next();
+            if (!text) return false;
+            value = static_cast<uint32_t>(std::strtoul(text, nullptr, 10));
+            return value > 0;
+        };
+        if (arg == "--help" || arg == "-h") {
+            options.help = true;
+        } else if (arg == "--headless") {
+            options.headless = true;
+        } else if (arg == "--width") {
+            if (!number(options.render.width)) return false;
+        } else if (arg == "--height") {
+            if (!number(options.render.height)) return false;
+        } else if (arg == "--spp") {
+            if (!number(options.render.samplesPerPixel)) return false;
+        } else if (arg == "--threads") {
+            uint32_t threads;
+            if (!number(threads)) return false;
+            options.maxThreads = threads;
+        } else if (arg == "--output") {
+            const char *path = next();
+            if (!path) return false;
+            options.output = path;
+        } else if (arg == "--scene") {
+            const char *path = next();
+            if (!path) return false;
+            options.scene = path;
+        } else if (arg == "--instances") {
+            if (!number(options.instances)) return false;
+        } else if (arg == "--wavefront") {
+            options.wavefront = true;
+        } else if (arg == "--profile") {
+            options.profile = true;
+        } else if (arg == "--trace") {
+            const char *path = next();
+            if (!path) return false;
+            options.trace = path;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Prints the zones, counters and per-thread idle time recorded by the profiler.
+void
+printProfile(const glpt::profile::Stats &stats) {
+    namespace profile = glpt::profile;
+    std::cout << '\n'
+              << std::left << std::setw(22) << "zone" << std::right << std::setw(10) << "calls"
+              << std::setw(14) << "total (ms)" << std::setw(12) << "mean (us)" << '\n';
+    for (std::size_t i = 0; i < profile::zoneCount; i++) {
+        auto               zone  = static_cast<profile::Zone>(i);
+        profile::ZoneStats total = stats.total(zone);
+        if (total.calls == 0) continue;
+        std::cout << std::left << std::setw(22) << profile::name(zone) << std::right
+                  << std::setw(10) << total.calls << std::fixed << std::setprecision(3)
+                  << std::setw(14) << total.milliseconds() << std::setw(12)
+                  << total.milliseconds() * 1e3 / static_cast<double>(total.calls) << '\n';
+    }
+
+    uint64_t rays    = stats.total(profile::Counter::Rays);
+    uint64_t shadows = stats.total(profile::Counter::ShadowRays);
+    auto     perRay  = [&](profile::Counter counter) {
+        if (rays + shadows == 0) return 0.0;
+        return static_cast<double>(stats.total(counter)) / static_cast<double>(rays + shadows);
+    };
+    std::cout << '\n'
+              << rays << " rays, " << shadows << " shadow rays\n"
+              << std::setprecision(1) << perRay(profile::Counter::NodeVisits)
+              << " node visits and " << perRay(profile::Counter::TriangleTests)
+              << " triangle tests per ray\n"
+              << "idle (ms) per thread:";
+    for (const auto &thread : stats.threads) {
+        const auto &idle = thread.zones[static_cast<std::size_t>(profile::Zone::Idle)];
+        if (idle.calls > 0) std::cout << ' ' << std::setprecision(2) << idle.milliseconds();
+    }
+    std::cout << '\n';
+}
+
+// Renders the scene once per thread count (powers of two up to the maximum) and reports
+// throughput and parallel scaling relative to the single-threaded run.
+int
+runHeadless(const Options &options, const glpt::SceneView &scene, const std::string &name) {
+    using Clock = std::chrono::steady_clock;
+
+    unsigned maxThreads = options.maxThreads;
+    if (maxThreads == 0) maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> threadCounts;
+    for (unsigned t = 1; t < maxThreads; t *= 2) {
+        threadCounts.push_back(t);
+    }
+    threadCounts.push_back(maxThreads);
+
+    const auto &settings = options.render;
+    auto        samples  = static_cast<double>(settings.width) * settings.height *
+                   settings.samplesPerPixel;
+
+    std::cout << name << (options.wavefront ? " (wavefront), " : ", ") << settings.width << "x"
+              << settings.height << ", " << settings.samplesPerPixel << " spp\n"
+              << std::setw(8) << "threads" << std::setw(12) << "time (s)" << std::setw(14)
+              << "Msamples/s" << std::setw(10) << "speedup" << std::setw(12) << "efficiency"
+              << std::setw(12) << "identical" << '\n';
+
+    glpt::WavefrontRenderer wavefront;
+    glpt::Image             reference;
+    double                  baseline  = 0.0;
+    bool                    profiling = options.profile || !options.trace.empty();
+    if (profiling && !glpt::profile::enabled) {
+        std::cerr << "warning: built without GLPT_ENABLE_PROFILING, nothing will be recorded\n";
+    }
+    for (unsigned threads : threadCounts) {
+        glpt::ThreadPool pool(threads);
+        // Only the last run is profiled.
+        if (threads == maxThreads) {
+            glpt::profile::reset();
+            glpt::profile::setTracing(!options.trace.empty());
+        }
+        auto             start   = Clock::now();
+        auto             image   = options.wavefront ? wavefront.render(scene, settings, pool)
+                                                     : glpt::render(scene, settings, pool);
+        double           seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if (threads == 1) {
+            baseline  = seconds;
+            reference = image;
+        }
+        double speedup = baseline / seconds;
+        std::cout << std::setw(8) << threads << std::fixed << std::setprecision(3)
+                  << std::setw(12) << seconds << std::setw(14) << samples / seconds * 1e-6
+                  << std::setprecision(2) << std::setw(10) << speedup << std::setw(11)
+                  << 100.0 * speedup / threads << '%' << std::setw(12)
+                  << (image.pixels == reference.pixels ? "yes" : "NO") << '\n';
+        if (threads == maxThreads && !options.output.empty()) {
+            if (!glpt::writePPM(image, options.output)) {
+                std::cerr << "failed to write " << options.output << '\n';
+                return EXIT_FAILURE;
+            }
+        }
+    }
+    glpt::profile::setTracing(false);
+    if (options.profile && glpt::profile::enabled) printProfile(glpt::profile::stats());
+    if (!options.trace.empty() && !glpt::profile::writeChromeTrace(options.trace)) {
+        std::cerr << "failed to write " << options.trace << '\n';
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+// Shows the scene in the viewer, or benchmarks it with --headless.
+int
+run(const Options &options, const glpt::SceneView &scene, const std::string &name) {
+    if (options.headless) return runHeadless(options, scene, name);
+    ViewerSettings viewer;
+    viewer.title             = "glpt - " + name;
+    viewer.render.width      = options.render.width;
+    viewer.render.height     = options.render.height;
+    viewer.render.tileSize   = options.render.tileSize;
+    viewer.render.seed       = options.render.seed;
+    viewer.render.integrator = options.render.integrator;
+    viewer.samplesPerPixel   = options.render.samplesPerPixel;
+    viewer.threads           = options.maxThreads;
+    viewer.output            = options.output;
+    viewer.profile           = options.profile;
+    return runViewer(scene, viewer);
+}
+
+} // namespace
 
 int
-main(int, char **) {
-    std::cout << glpt::foo() << std::endl;
+main(int argc, char **argv) {
+    Options options;
+    if (!parseArgs(argc, argv, options)) {
+        usage(std::cerr, argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (options.help) {
+        usage(std::cout, argv[0]);
+        return EXIT_SUCCESS;
+    }
+    if (!options.scene.empty() && options.instances > 0) {
+        std::cerr << "error: --instances only applies to the Cornell box\n";
+        return EXIT_FAILURE;
+    }
+    if (options.instances > 0) {
+        auto scene = glpt::makeInstancedCornellBox(options.instances, 1);
+        return run(
+            options,
+            scene.view(),
+            "Cornell box with " + std::to_string(options.instances) + " instances");
+    }
+    if (options.scene.empty()) {
+        auto scene = glpt::makeCornellBox();
+        return run(options, scene.view(), "Cornell box");
+    }
+    try {
+        glpt::SceneFileOptions load;
+        load.buildWideBvh = true;
+        auto            start = std::chrono::steady_clock::now();
+        glpt::SceneFile file(options.scene, load);
+        std::chrono::duration<double, std::milli> loadTime =
+            std::chrono::steady_clock::now() - start;
+        std::cout << "loaded " << options.scene << " (" << file.view().mesh.triangleCount()
+                  << " triangles) in " << std::fixed << std::setprecision(3) << loadTime.count()
+                  << " ms\n";
+        return run(options, file.view(), options.scene);
+    } catch (const std::exception &e) {
+        std::cerr << "error: " << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
 }
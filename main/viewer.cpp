@@ -0,0 +1,219 @@
+//
+// Created by taylor-santos on 10/16/2026 at 23:58.
+//
+
+#include "viewer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <imgui.h>
+#include <imgui_impl_glfw.h>
+#include <imgui_impl_opengl3.h>
+
+#include "image.hpp"
+#include "profiler.hpp"
+#include "thread_pool.hpp"
+
+namespace {
+
+// GLFW returns function pointers and glad expects object pointers, so the loader can't be passed
+// straight through without a cast between incompatible function types.
+void *
+loadGL(const char *name) {
+    return reinterpret_cast<void *>(glfwGetProcAddress(name));
+}
+
+// Uploads image to texture, which must have the same size, as 8-bit sRGB.
+void
+upload(const glpt::Image &image, GLuint texture, std::vector<unsigned char> &rgba) {
+    rgba.resize(image.pixels.size() * 4);
+    for (std::size_t i = 0; i < image.pixels.size(); i++) {
+        for (int c = 0; c < 3; c++) {
+            rgba[i * 4 + c] = glpt::encodeSRGB(image.pixels[i][c]);
+        }
+        rgba[i * 4 + 3] = 255;
+    }
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexSubImage2D(
+        GL_TEXTURE_2D,
+        0,
+        0,
+        0,
+        static_cast<GLsizei>(image.width),
+        static_cast<GLsizei>(image.height),
+        GL_RGBA,
+        GL_UNSIGNED_BYTE,
+        rgba.data());
+}
+
+// Draws the texture behind every window, as large as fits with the image's aspect ratio.
+void
+drawImage(GLuint texture, uint32_t width, uint32_t height) {
+    ImVec2 display = ImGui::GetIO().DisplaySize;
+    float  scale   = std::min(
+        display.x / static_cast<float>(width), display.y / static_cast<float>(height));
+    ImVec2 size{static_cast<float>(width) * scale, static_cast<float>(height) * scale};
+    ImVec2 corner{(display.x - size.x) * 0.5f, (display.y - size.y) * 0.5f};
+    ImGui::GetBackgroundDrawList()->AddImage(
+        reinterpret_cast<ImTextureID>(static_cast<std::uintptr_t>(texture)),
+        corner,
+        {corner.x + size.x, corner.y + size.y});
+}
+
+} // namespace
+
+int
+runViewer(const glpt::SceneView &scene, const ViewerSettings &settings) {
+    const glpt::ProgressiveSettings &render = settings.render;
+    if (!glfwInit()) {
+        std::cerr << "error: failed to initialize GLFW, try --headless\n";
+        return EXIT_FAILURE;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_TRUE);
+    GLFWwindow *window = glfwCreateWindow(
+        static_cast<int>(render.width),
+        static_cast<int>(render.height),
+        settings.title.c_str(),
+        nullptr,
+        nullptr);
+    if (window) glfwMakeContextCurrent(window);
+    if (!window || !gladLoadGLLoader(loadGL)) {
+        std::cerr << "error: failed to create an OpenGL 3.3 window, try --headless\n";
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+    glfwSwapInterval(1);
+
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGui_ImplGlfw_InitForOpenGL(window, true);
+    ImGui_ImplOpenGL3_Init("#version 330");
+
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexImage2D(
+        GL_TEXTURE_2D,
+        0,
+        GL_RGBA8,
+        static_cast<GLsizei>(render.width),
+        static_cast<GLsizei>(render.height),
+        0,
+        GL_RGBA,
+        GL_UNSIGNED_BYTE,
+        nullptr);
+
+    // Enough passes to reach samplesPerPixel, rounding up.
+    uint32_t perPass = render.samplesPerPass;
+    uint32_t passes  = (settings.samplesPerPixel + perPass - 1) / perPass;
+
+    using Clock = std::chrono::steady_clock;
+    glpt::ProgressiveRenderer renderer(render);
+    glpt::ThreadPool          pool(settings.threads);
+    std::atomic<bool>         stop{false};
+    std::atomic<uint64_t>     samples{0};
+    std::atomic<double>       seconds{0.0};
+    // The profiler totals of the last finished pass, for the overlay.
+    std::mutex                statsMutex;
+    glpt::profile::Stats      lastPass;
+
+    std::thread passThread([&] {
+        auto start = Clock::now();
+        glpt::profile::reset();
+        while (!stop.load(std::memory_order_relaxed) && renderer.passes() < passes &&
+               !renderer.converged()) {
+            samples.fetch_add(renderer.renderPass(scene, pool), std::memory_order_relaxed);
+            seconds.store(
+                std::chrono::duration<double>(Clock::now() - start).count(),
+                std::memory_order_relaxed);
+            if constexpr (glpt::profile::enabled) {
+                glpt::profile::Stats stats = glpt::profile::stats();
+                glpt::profile::reset();
+                std::lock_guard lock(statsMutex);
+                lastPass = std::move(stats);
+            }
+        }
+    });
+
+    glpt::Image                image;
+    std::vector<unsigned char> rgba;
+    double                     pixels      = static_cast<double>(render.width) * render.height;
+    bool                       showProfile = settings.profile;
+    while (!glfwWindowShouldClose(window)) {
+        glfwPollEvents();
+        renderer.snapshot(image);
+        upload(image, texture, rgba);
+
+        ImGui_ImplOpenGL3_NewFrame();
+        ImGui_ImplGlfw_NewFrame();
+        ImGui::NewFrame();
+        drawImage(texture, render.width, render.height);
+
+        ImGui::SetNextWindowPos({10.0f, 10.0f}, ImGuiCond_FirstUseEver);
+        ImGui::Begin("Render", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
+        auto   traced  = static_cast<double>(samples.load(std::memory_order_relaxed));
+        double elapsed = seconds.load(std::memory_order_relaxed);
+        ImGui::Text(
+            "%u of %u passes, %.1f samples per pixel",
+            renderer.passes(),
+            passes,
+            traced / pixels);
+        ImGui::Text("%.2f Msamples/s", elapsed > 0.0 ? traced / elapsed * 1e-6 : 0.0);
+        if (renderer.converged()) ImGui::TextUnformatted("Converged");
+        ImGui::Checkbox("Profiler (P)", &showProfile);
+        ImGui::End();
+
+        if (!ImGui::GetIO().WantCaptureKeyboard && ImGui::IsKeyPressed(GLFW_KEY_P, false)) {
+            showProfile = !showProfile;
+        }
+        if (showProfile) {
+            std::lock_guard lock(statsMutex);
+            glpt::profile::drawOverlay(lastPass, &showProfile);
+        }
+
+        ImGui::Render();
+        int width;
+        int height;
+        glfwGetFramebufferSize(window, &width, &height);
+        glViewport(0, 0, width, height);
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        glfwSwapBuffers(window);
+    }
+    stop.store(true, std::memory_order_relaxed);
+    passThread.join();
+
+    int status = EXIT_SUCCESS;
+    if (!settings.output.empty()) {
+        renderer.snapshot(image);
+        if (!glpt::writePPM(image, settings.output)) {
+            std::cerr << "failed to write " << settings.output << '\n';
+            status = EXIT_FAILURE;
+        }
+    }
+
+    glDeleteTextures(1, &texture);
+    ImGui_ImplOpenGL3_Shutdown();
+    ImGui_ImplGlfw_Shutdown();
+    ImGui::DestroyContext();
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return status;
+}
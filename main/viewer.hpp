@@ -0,0 +1,31 @@
+//
+// Created by taylor-santos on 10/16/2026 at 23:58.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "progressive.hpp"
+#include "scene.hpp"
+
+struct ViewerSettings {
+    std::string               title;
+    glpt::ProgressiveSettings render;
+    // Sampling stops once every pixel has this many samples, or earlier if adaptive sampling
+    // decides the image has converged.
+    uint32_t    samplesPerPixel = 16;
+    // Render threads; zero uses every core.
+    unsigned    threads         = 0;
+    // Where to write the image when the window closes, if not empty.
+    std::string output;
+    // Whether the profiler overlay starts open. P or its checkbox toggles it either way.
+    bool        profile = false;
+};
+
+// Opens a window and shows the scene converging. Passes run on a thread of their own, and the
+// window shows the tiles they publish, so it stays responsive however long a pass takes. Returns
+// the exit status for main.
+int
+runViewer(const glpt::SceneView &scene, const ViewerSettings &settings);
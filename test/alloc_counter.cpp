@@ -0,0 +1,147 @@
+//
+// Created by taylor-santos on 10/16/2026 at 21:34.
+//
+
+#include "alloc_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<uint64_t> allocations{0};
+
+void *
+countedAlloc(std::size_t size, std::size_t alignment) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) size = 1;
+    void *ptr;
+#ifdef _WIN32
+    ptr = _aligned_malloc(size, alignment);
+#else
+    if (alignment < sizeof(void *)) alignment = sizeof(void *);
+    if (posix_memalign(&ptr, alignment, size) != 0) ptr = nullptr;
+#endif
+    return ptr;
+}
+
+void
+countedFree(void *ptr) noexcept {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+} // namespace
+
+uint64_t
+glpt::test::allocationCount() {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+// Every allocation goes through countedAlloc, so a single countedFree matches every delete.
+
+void *
+operator new(std::size_t size) {
+    if (void *ptr = countedAlloc(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__)) return ptr;
+    throw std::bad_alloc();
+}
+
+void *
+operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void *
+operator new(std::size_t size, std::align_val_t alignment) {
+    if (void *ptr = countedAlloc(size, static_cast<std::size_t>(alignment))) return ptr;
+    throw std::bad_alloc();
+}
+
+void *
+operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void *
+operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    return countedAlloc(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void *
+operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+    return countedAlloc(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void *
+operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return countedAlloc(size, static_cast<std::size_t>(alignment));
+}
+
+void *
+operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return countedAlloc(size, static_cast<std::size_t>(alignment));
+}
+
+void
+operator delete(void *ptr) noexcept {
+    countedFree(ptr);
+}
+
+void
+operator delete[](void *ptr) noexcept {
+    countedFree(ptr);
+}
+
+void
+operator delete(void *ptr, std::size_t) noexcept {
+    countedFree(ptr);
+}
+
+void
+operator delete[](void *ptr, std::size_t) noexcept {
+    countedFree(ptr);
+}
+
+void
+operator delete(void *ptr, std::align_val_t) noexcept {
+    countedFree(ptr);
+}
+
+void
+operator delete[](void *ptr, std::align_val_t) noexcept {
+    countedFree(ptr);
+}
+
+void
+operator delete(void *ptr, std::size_t, std::align_val_t) noexcept {
+    countedFree(ptr);
+}
+
+void
+operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept {
+    countedFree(ptr);
+}
+
+void
+operator delete(void *ptr, const std::nothrow_t &) noexcept {
+    countedFree(ptr);
+}
+
+void
+operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+    countedFree(ptr);
+}
+
+void
+operator delete(void *ptr, std::align_val_t, const std::nothrow_t &) noexcept {
+    countedFree(ptr);
+}
+
+void
+operator delete[](void *ptr, std::align_val_t, const std::nothrow_t &) noexcept {
+    countedFree(ptr);
+}
@@ -0,0 +1,32 @@
+//
+// Created by taylor-santos on 10/16/2026 at 21:30.
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace glpt::test {
+
+// Number of calls to the global operator new (every form) made by any thread since the program
+// started. The replacement operators live in alloc_counter.cpp, which must be linked into the
+// executable for this to count anything.
+uint64_t
+allocationCount();
+
+// Allocations made by any thread while an instance is alive.
+class AllocationCounter {
+public:
+    AllocationCounter()
+        : start_{allocationCount()} {}
+
+    [[nodiscard]] uint64_t
+    count() const {
+        return allocationCount() - start_;
+    }
+
+private:
+    uint64_t start_;
+};
+
+} // namespace glpt::test
@@ -0,0 +1,431 @@
+//
+// Created by taylor-santos on 10/16/2026 at 11:40.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#    define WIN32_LEAN_AND_MEAN
+#    define NOMINMAX
+#    include <windows.h>
+#    include <psapi.h>
+#else
+#    include <sys/resource.h>
+#endif
+
+#include "alloc_counter.hpp"
+#include "integrator.hpp"
+#include "procedural.hpp"
+#include "profiler.hpp"
+#include "renderer.hpp"
+#include "sampling.hpp"
+#include "wide_bvh.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::size_t soupSize   = 1'000'000;
+    unsigned    maxThreads = 0;
+    bool        quick      = false;
+    std::string json;
+    std::string baseline;
+    // Relative change past which a timing or memory figure counts as a regression. Exact metrics
+    // regress on any change for the worse.
+    double tolerance = 0.10;
+    // Fail on regressions in timings and memory too, not only in exact metrics.
+    bool gateTimings = false;
+};
+
+void
+usage(const char *program) {
+    std::cerr << "usage: " << program << " [options]\n"
+              << "  --quick          smaller scenes and images, for CI\n"
+              << "  --soup N         triangles in the soup scene (default 1000000)\n"
+              << "  --threads N      highest thread count to render with (default: all cores)\n"
+              << "  --json FILE      write the results as JSON\n"
+              << "  --baseline FILE  compare against JSON from an earlier run and fail on\n"
+              << "                   regressions in exact metrics\n"
+              << "  --tolerance X    allowed relative regression in timings and memory\n"
+              << "                   (default 0.10)\n"
+              << "  --gate-timings   also fail on regressions in timings and memory\n";
+}
+
+bool
+parseArgs(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg  = argv[i];
+        auto        next = [&]() -> const char * { return i + 1 < argc ? argv[++i] : nullptr; };
+        if (arg == "--quick") {
+            options.quick    = true;
+            options.soupSize = 100'000;
+        } else if (arg == "--soup") {
+            const char *text = next();
+            if (!text) return false;
+            options.soupSize = std::strtoull(text, nullptr, 10);
+            if (options.soupSize == 0) return false;
+        } else if (arg == "--threads") {
+            const char *text = next();
+            if (!text) return false;
+            options.maxThreads = static_cast<unsigned>(std::strtoul(text, nullptr, 10));
+            if (options.maxThreads == 0) return false;
+        } else if (arg == "--json") {
+            const char *path = next();
+            if (!path) return false;
+            options.json = path;
+        } else if (arg == "--baseline") {
+            const char *path = next();
+            if (!path) return false;
+            options.baseline = path;
+        } else if (arg == "--tolerance") {
+            const char *text = next();
+            if (!text) return false;
+            options.tolerance = std::strtod(text, nullptr);
+        } else if (arg == "--gate-timings") {
+            options.gateTimings = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Exact metrics, such as node visits and allocation counts, come out the same on every run of
+// the same build, so any change in them is caused by the code. Timings and memory use also depend
+// on the machine and whatever else runs on it.
+enum class Kind {
+    Exact,
+    Noisy,
+};
+
+struct Metric {
+    std::string name;
+    std::string unit;
+    bool        higherIsBetter;
+    Kind        kind;
+    double      value;
+};
+
+// Collects metrics, echoing each one as it is measured.
+class Report {
+public:
+    void
+    add(const std::string &name,
+        const std::string &unit,
+        bool               higherIsBetter,
+        Kind               kind,
+        double             value) {
+        std::cout << std::left << std::setw(40) << name << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(14) << value << ' ' << unit << std::endl;
+        metrics_.push_back({name, unit, higherIsBetter, kind, value});
+    }
+
+    [[nodiscard]] const std::vector<Metric> &
+    metrics() const {
+        return metrics_;
+    }
+
+    // One metric per line, so that readBaseline doesn't need a real JSON parser.
+    bool
+    writeJson(const std::string &path) const {
+        std::ofstream file(path);
+        file << "{\n  \"version\": 1,\n  \"metrics\": [\n";
+        for (std::size_t i = 0; i < metrics_.size(); i++) {
+            const Metric &m = metrics_[i];
+            file << "    {\"name\": \"" << m.name << "\", \"unit\": \"" << m.unit
+                 << "\", \"better\": \"" << (m.higherIsBetter ? "higher" : "lower")
+                 << "\", \"value\": "
+                 // Enough digits to read back the same double, for the exact comparisons.
+                 << std::setprecision(std::numeric_limits<double>::max_digits10) << m.value << '}'
+                 << (i + 1 < metrics_.size() ? ",\n" : "\n");
+        }
+        file << "  ]\n}\n";
+        return static_cast<bool>(file);
+    }
+
+private:
+    std::vector<Metric> metrics_;
+};
+
+// Reads the name and value of every metric in a file written by Report::writeJson.
+std::map<std::string, double>
+readBaseline(const std::string &path) {
+    std::map<std::string, double> values;
+    std::ifstream                 file(path);
+    std::string                   line;
+    const std::string             nameKey  = "\"name\": \"";
+    const std::string             valueKey = "\"value\": ";
+    while (std::getline(file, line)) {
+        auto name  = line.find(nameKey);
+        auto value = line.find(valueKey);
+        if (name == std::string::npos || value == std::string::npos) continue;
+        name += nameKey.size();
+        auto end = line.find('"', name);
+        values[line.substr(name, end - name)] =
+            std::strtod(line.c_str() + value + valueKey.size(), nullptr);
+    }
+    return values;
+}
+
+// Prints every metric next to its baseline, flagging exact metrics that got worse at all and
+// noisy ones that got worse by more than the tolerance, and returns how many of the flagged ones
+// are gated.
+int
+compare(
+    const Report                        &report,
+    const std::map<std::string, double> &baseline,
+    const Options                       &options) {
+    int    regressions = 0;
+    double tolerance   = options.tolerance;
+    std::cout << "\ncompared to baseline (exact metrics must not regress, timings tolerance "
+              << tolerance * 100.0 << "%" << (options.gateTimings ? "" : ", not gated") << "):\n";
+    for (const Metric &m : report.metrics()) {
+        auto it = baseline.find(m.name);
+        if (it == baseline.end()) continue;
+        double before  = it->second;
+        double allowed = m.kind == Kind::Exact ? 0.0 : tolerance;
+        bool   worse   = m.higherIsBetter ? m.value < before * (1.0 - allowed)
+                                          : m.value > before * (1.0 + allowed);
+        bool   gated   = m.kind == Kind::Exact || options.gateTimings;
+        double change  = before != 0.0 ? (m.value - before) / before * 100.0 : 0.0;
+        std::cout << std::left << std::setw(40) << m.name << std::right << std::setw(14)
+                  << before << " -> " << std::setw(14) << m.value << std::setprecision(1)
+                  << std::setw(9) << std::showpos << change << '%' << std::noshowpos
+                  << std::setprecision(3)
+                  << (!worse ? "" : gated ? "  REGRESSION" : "  worse (not gated)") << '\n';
+        regressions += worse && gated;
+    }
+    return regressions;
+}
+
+// Peak resident set size of the process so far, in MiB.
+double
+peakMemoryMiB() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0.0;
+    return static_cast<double>(counters.PeakWorkingSetSize) / (1024.0 * 1024.0);
+#else
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+#    ifdef __APPLE__
+    return static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0); // bytes
+#    else
+    return static_cast<double>(usage.ru_maxrss) / 1024.0; // KiB
+#    endif
+#endif
+}
+
+// Fastest of a few runs of fn, in seconds. Short workloads are repeated to filter out noise.
+template<typename Fn>
+double
+fastest(Fn &&fn) {
+    double best  = 0.0;
+    double total = 0.0;
+    for (int run = 0; run < 5 && total < 0.5; run++) {
+        auto   start   = Clock::now();
+        fn();
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        best           = run == 0 ? seconds : std::min(best, seconds);
+        total += seconds;
+    }
+    return best;
+}
+
+// One jittered camera ray per pixel, seeded like the renderer's first sample.
+std::vector<glpt::Ray>
+primaryRays(const glpt::SceneView &scene, uint32_t width, uint32_t height) {
+    std::vector<glpt::Ray> rays;
+    rays.reserve(static_cast<std::size_t>(width) * height);
+    for (uint32_t y = 0; y < height; y++) {
+        for (uint32_t x = 0; x < width; x++) {
+            glpt::Pcg32 rng = glpt::pixelSampler(y * width + x, 0, 0);
+            rays.push_back(glpt::primaryRay(scene.camera, x, y, width, height, rng));
+        }
+    }
+    return rays;
+}
+
+// Diffuse bounce rays leaving every primary hit: the incoherent rays that dominate a render.
+std::vector<glpt::Ray>
+secondaryRays(const glpt::SceneView &scene, const std::vector<glpt::Ray> &primary) {
+    std::vector<glpt::Ray> rays;
+    rays.reserve(primary.size());
+    glpt::Pcg32 rng(1);
+    for (const auto &ray : primary) {
+        glpt::InstanceHit hit;
+        if (!scene.intersect(ray, hit)) continue;
+        glm::vec3 normal = glm::normalize(scene.normal(hit));
+        if (glm::dot(normal, ray.direction) > 0.0f) normal = -normal;
+        glm::vec3 point = ray.origin + ray.direction * hit.t + normal * glpt::rayEpsilon;
+        float     u1    = rng.nextFloat();
+        float     u2    = rng.nextFloat();
+        rays.push_back({point, glpt::sampleCosineHemisphere(normal, u1, u2)});
+    }
+    return rays;
+}
+
+// Traces every ray on the calling thread and returns millions of rays per second. Fails loudly
+// if a traversal kernel disagrees with the others.
+template<typename Intersect>
+double
+traceRate(const std::vector<glpt::Ray> &rays, Intersect &&intersect, std::size_t &hits) {
+    std::size_t count   = 0;
+    double      seconds = fastest([&] {
+        count = 0;
+        for (const auto &ray : rays) {
+            glpt::Hit hit;
+            count += intersect(ray, hit);
+        }
+    });
+    if (hits != ~std::size_t{0} && hits != count) {
+        std::cerr << "traversal kernels disagree on the number of hits\n";
+        std::exit(EXIT_FAILURE);
+    }
+    hits = count;
+    return static_cast<double>(rays.size()) / seconds * 1e-6;
+}
+
+// Reports the tracing rate of one traversal kernel and, in a profiling build, how many BVH nodes
+// and triangles it visits per ray.
+template<typename Intersect>
+void
+benchKernel(
+    Report                       &report,
+    const std::string            &name,
+    const std::vector<glpt::Ray> &rays,
+    Intersect                   &&intersect,
+    std::size_t                  &hits) {
+    report.add(name, "Mrays/s", true, Kind::Noisy, traceRate(rays, intersect, hits));
+    if (!glpt::profile::enabled || rays.empty()) return;
+
+    glpt::profile::reset();
+    for (const auto &ray : rays) {
+        glpt::Hit hit;
+        intersect(ray, hit);
+    }
+    using glpt::profile::Counter;
+    auto stats  = glpt::profile::stats();
+    auto perRay = [&](Counter counter) {
+        return static_cast<double>(stats.total(counter)) / static_cast<double>(rays.size());
+    };
+    report.add(name + ".node_visits", "/ray", false, Kind::Exact, perRay(Counter::NodeVisits));
+    report.add(
+        name + ".triangle_tests", "/ray", false, Kind::Exact, perRay(Counter::TriangleTests));
+}
+
+void
+benchRays(
+    Report                       &report,
+    const std::string            &prefix,
+    const glpt::Scene            &scene,
+    const std::vector<glpt::Ray> &rays) {
+    auto mesh  = scene.mesh.view();
+    auto wide4 = glpt::WideBVH<4>::build(scene.bvh.view(), mesh);
+    auto wide8 = glpt::WideBVH<8>::build(scene.bvh.view(), mesh);
+
+    std::size_t hits = ~std::size_t{0};
+    benchKernel(report, prefix + ".binary", rays, [&](const glpt::Ray &ray, glpt::Hit &hit) {
+        return scene.bvh.intersect(ray, mesh, hit);
+    }, hits);
+    benchKernel(report, prefix + ".wide4", rays, [&](const glpt::Ray &ray, glpt::Hit &hit) {
+        return wide4.intersect(ray, hit);
+    }, hits);
+    benchKernel(report, prefix + ".wide8", rays, [&](const glpt::Ray &ray, glpt::Hit &hit) {
+        return wide8.intersect(ray, hit);
+    }, hits);
+}
+
+void
+benchScene(
+    Report                     &report,
+    const Options              &options,
+    const std::string          &name,
+    const glpt::Scene          &scene,
+    const glpt::RenderSettings &settings) {
+    auto   mesh  = scene.mesh.view();
+    double build = fastest([&] { (void)glpt::BVH::build(mesh); });
+    report.add(name + ".bvh_build", "ms", false, Kind::Noisy, build * 1e3);
+    report.add(name + ".bvh_sah", "", false, Kind::Exact, scene.bvh.sahCost());
+
+    auto primary   = primaryRays(scene.view(), settings.width, settings.height);
+    auto secondary = secondaryRays(scene.view(), primary);
+    benchRays(report, name + ".primary", scene, primary);
+    benchRays(report, name + ".secondary", scene, secondary);
+
+    unsigned maxThreads = options.maxThreads;
+    if (maxThreads == 0) maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    auto samples =
+        static_cast<double>(settings.width) * settings.height * settings.samplesPerPixel;
+    glpt::Image image;
+    for (unsigned threads = 1;; threads = std::min(threads * 2, maxThreads)) {
+        glpt::ThreadPool pool(threads);
+        double           seconds =
+            fastest([&] { glpt::render(scene.view(), settings, pool, image); });
+        report.add(
+            name + ".render.threads_" + std::to_string(threads),
+            "Msamples/s",
+            true,
+            Kind::Noisy,
+            samples / seconds * 1e-6);
+        if (threads == maxThreads) {
+            // The frame was rendered at least once already, so this is a steady-state frame.
+            glpt::test::AllocationCounter counter;
+            glpt::render(scene.view(), settings, pool, image);
+            auto allocations = static_cast<double>(counter.count());
+            report.add(name + ".render.allocations", "", false, Kind::Exact, allocations);
+            break;
+        }
+    }
+    report.add(name + ".peak_memory", "MiB", false, Kind::Noisy, peakMemoryMiB());
+}
+
+} // namespace
+
+int
+main(int argc, char **argv) {
+    Options options;
+    if (!parseArgs(argc, argv, options)) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    glpt::RenderSettings settings;
+    settings.width           = options.quick ? 128 : 512;
+    settings.height          = options.quick ? 128 : 512;
+    settings.samplesPerPixel = 4;
+
+    // Smallest scene first, so that each peak memory figure is dominated by its own scene.
+    Report report;
+    benchScene(report, options, "cornell", glpt::makeCornellBox(), settings);
+    benchScene(report, options, "soup", glpt::makeSoupScene(options.soupSize, 1), settings);
+
+    if (!options.json.empty() && !report.writeJson(options.json)) {
+        std::cerr << "failed to write " << options.json << '\n';
+        return EXIT_FAILURE;
+    }
+    if (!options.baseline.empty()) {
+        auto baseline = readBaseline(options.baseline);
+        if (baseline.empty()) {
+            std::cerr << "no metrics in baseline " << options.baseline << '\n';
+            return EXIT_FAILURE;
+        }
+        int regressions = compare(report, baseline, options);
+        if (regressions > 0) {
+            std::cerr << regressions << " metric(s) regressed\n";
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,97 @@
+//
+// Created by taylor-santos on 10/16/2026 at 21:52.
+//
+
+#include "doctest/doctest.h"
+
+#include <cstdint>
+
+#include "alloc_counter.hpp"
+#include "arena.hpp"
+#include "procedural.hpp"
+#include "progressive.hpp"
+#include "renderer.hpp"
+#include "wavefront.hpp"
+
+TEST_SUITE_BEGIN("arena");
+
+TEST_CASE("allocations are aligned and disjoint") {
+    glpt::Arena arena(256);
+    auto        bytes  = arena.allocate<uint8_t>(3, 7);
+    auto        floats = arena.allocate<float>(100, 1.5f);
+    void       *wide   = arena.allocate(64, 64);
+    CHECK(reinterpret_cast<std::uintptr_t>(floats.data()) % alignof(float) == 0);
+    CHECK(reinterpret_cast<std::uintptr_t>(wide) % 64 == 0);
+    CHECK(bytes[2] == 7);
+    CHECK(floats[99] == 1.5f);
+    CHECK((bytes.data() + bytes.size() <= reinterpret_cast<uint8_t *>(floats.data()) ||
+           reinterpret_cast<uint8_t *>(floats.data() + floats.size()) <= bytes.data()));
+}
+
+TEST_CASE("reset keeps a single block that fits the previous cycle") {
+    glpt::Arena arena(128);
+    for (int i = 0; i < 10; i++) {
+        (void)arena.allocate<float>(100);
+    }
+    arena.reset();
+    std::size_t capacity = arena.capacity();
+
+    glpt::test::AllocationCounter counter;
+    for (int frame = 0; frame < 3; frame++) {
+        for (int i = 0; i < 10; i++) {
+            (void)arena.allocate<float>(100);
+        }
+        arena.reset();
+    }
+    CHECK(counter.count() == 0);
+    CHECK(arena.capacity() == capacity);
+}
+
+TEST_CASE("steady-state frames do not allocate") {
+    auto             scene = glpt::makeCornellBox();
+    glpt::ThreadPool pool(4);
+
+    SUBCASE("megakernel") {
+        glpt::RenderSettings settings;
+        settings.width           = 32;
+        settings.height          = 32;
+        settings.samplesPerPixel = 2;
+        glpt::Image image;
+        glpt::render(scene.view(), settings, pool, image);
+
+        glpt::test::AllocationCounter counter;
+        glpt::render(scene.view(), settings, pool, image);
+        CHECK(counter.count() == 0);
+    }
+    SUBCASE("wavefront") {
+        glpt::RenderSettings settings;
+        settings.width           = 32;
+        settings.height          = 32;
+        settings.samplesPerPixel = 2;
+        glpt::WavefrontRenderer renderer({500, true});
+        glpt::Image             image;
+        renderer.render(scene.view(), settings, pool, image);
+
+        glpt::test::AllocationCounter counter;
+        renderer.render(scene.view(), settings, pool, image);
+        CHECK(counter.count() == 0);
+        CHECK(image.pixels == glpt::render(scene.view(), settings, pool).pixels);
+    }
+    SUBCASE("progressive") {
+        glpt::ProgressiveSettings settings;
+        settings.width  = 32;
+        settings.height = 32;
+        glpt::ProgressiveRenderer renderer(settings);
+        glpt::Image               image;
+        renderer.snapshot(image);
+
+        glpt::test::AllocationCounter counter;
+        for (int pass = 0; pass < 3; pass++) {
+            renderer.renderPass(scene.view(), pool);
+            renderer.snapshot(image);
+        }
+        CHECK(counter.count() == 0);
+    }
+}
+
+TEST_SUITE_END();
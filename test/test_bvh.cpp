@@ -0,0 +1,294 @@
+//
+// Created by taylor-santos on 10/16/2026 at 11:02.
+//
+
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "bvh.hpp"
+#include "procedural.hpp"
+#include "random.hpp"
+
+namespace {
+
+glpt::Hit
+bruteForce(const glpt::Ray &ray, const glpt::MeshView &mesh) {
+    glpt::Hit hit;
+    for (uint32_t i = 0; i < mesh.triangleCount(); i++) {
+        const glm::uvec3 &tri = mesh.triangles[i];
+        float             t, u, v;
+        if (glpt::intersectTriangle(
+                ray,
+                mesh.positions[tri.x],
+                mesh.positions[tri.y],
+                mesh.positions[tri.z],
+                std::min(ray.tMax, hit.t),
+                t,
+                u,
+                v)) {
+            hit = {t, u, v, i};
+        }
+    }
+    return hit;
+}
+
+std::vector<glpt::Ray>
+randomRays(std::size_t count, uint32_t seed) {
+    glpt::Pcg32            rng(seed);
+    std::vector<glpt::Ray> rays(count);
+    for (auto &ray : rays) {
+        ray.origin = glm::vec3{rng.nextFloat(), rng.nextFloat(), rng.nextFloat()} * 3.0f - 1.0f;
+        glm::vec3 target{rng.nextFloat(), rng.nextFloat(), rng.nextFloat()};
+        ray.direction = glm::normalize(target - ray.origin);
+    }
+    return rays;
+}
+
+// Walks the flattened tree and checks the depth-first layout and bounds, returning the depth.
+uint32_t
+validate(
+    const glpt::BVH      &bvh,
+    const glpt::MeshView &mesh,
+    uint32_t              index,
+    std::vector<int>     &seen) {
+    const glpt::BVHNode &node = bvh.nodes()[index];
+    if (node.isLeaf()) {
+        for (uint32_t i = node.offset; i < node.offset + node.count; i++) {
+            uint32_t prim = bvh.primIndices()[i];
+            seen[prim]++;
+            CHECK(node.bounds().contains(mesh.triangleBounds(prim)));
+        }
+        return 1;
+    }
+    uint32_t left  = index + 1;
+    uint32_t right = node.offset;
+    REQUIRE(right > left);
+    REQUIRE(right < bvh.nodes().size());
+    CHECK(node.bounds().contains(bvh.nodes()[left].bounds()));
+    CHECK(node.bounds().contains(bvh.nodes()[right].bounds()));
+    return 1 + std::max(validate(bvh, mesh, left, seen), validate(bvh, mesh, right, seen));
+}
+
+// Moves every vertex by up to amount along each axis.
+void
+jitter(glpt::Mesh &mesh, float amount, uint32_t seed) {
+    glpt::Pcg32 rng(seed);
+    for (auto &position : mesh.positions) {
+        glm::vec3 offset{rng.nextFloat(), rng.nextFloat(), rng.nextFloat()};
+        position += (offset * 2.0f - 1.0f) * amount;
+    }
+}
+
+} // namespace
+
+TEST_SUITE_BEGIN("bvh");
+
+TEST_CASE("node layout matches the GPU struct") {
+    CHECK(sizeof(glpt::BVHNode) == 32);
+    CHECK(offsetof(glpt::BVHNode, offset) == 12);
+    CHECK(offsetof(glpt::BVHNode, max) == 16);
+    CHECK(offsetof(glpt::BVHNode, count) == 28);
+}
+
+TEST_CASE("empty mesh") {
+    glpt::Mesh mesh;
+    auto       bvh = glpt::BVH::build(mesh.view());
+    CHECK(bvh.nodes().empty());
+    glpt::Hit hit;
+    CHECK_FALSE(bvh.intersect({}, mesh.view(), hit));
+    CHECK_FALSE(bvh.occluded({}, mesh.view()));
+}
+
+TEST_CASE("single triangle") {
+    glpt::Mesh mesh;
+    mesh.positions = {{-1.0f, -1.0f, 0.0f}, {1.0f, -1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+    mesh.triangles = {{0, 1, 2}};
+    auto bvh       = glpt::BVH::build(mesh.view());
+    REQUIRE(bvh.nodes().size() == 1);
+    CHECK(bvh.nodes()[0].count == 1);
+
+    glpt::Ray ray{{0.0f, 0.0f, -2.0f}, {0.0f, 0.0f, 1.0f}};
+    glpt::Hit hit;
+    REQUIRE(bvh.intersect(ray, mesh.view(), hit));
+    CHECK(hit.t == doctest::Approx(2.0f));
+    CHECK(hit.prim == 0);
+
+    ray.tMax = 1.0f;
+    CHECK_FALSE(bvh.occluded(ray, mesh.view()));
+}
+
+TEST_CASE("tree structure") {
+    auto mesh = glpt::makeTriangleSoup(20000, 1);
+    // The second configuration forces the parallel build paths even on single-core machines.
+    for (unsigned threads : {1u, 4u}) {
+        glpt::BVHBuildOptions options;
+        options.threadCount       = threads;
+        options.parallelThreshold = threads == 1 ? options.parallelThreshold : 256;
+        auto bvh                  = glpt::BVH::build(mesh.view(), options);
+
+        std::vector<int> seen(mesh.triangles.size(), 0);
+        uint32_t         depth = validate(bvh, mesh.view(), 0, seen);
+        CHECK(depth <= glpt::BVHView::maxDepth);
+        CHECK(std::all_of(seen.begin(), seen.end(), [](int n) { return n == 1; }));
+        for (const auto &node : bvh.nodes()) {
+            CHECK(node.count <= options.maxLeafSize);
+        }
+    }
+}
+
+TEST_CASE("closest hit matches brute force") {
+    auto mesh = glpt::makeTriangleSoup(5000, 2);
+    auto bvh  = glpt::BVH::build(mesh.view());
+    int  hits = 0;
+    for (const auto &ray : randomRays(2000, 3)) {
+        glpt::Hit expected = bruteForce(ray, mesh.view());
+        glpt::Hit actual;
+        CHECK(bvh.intersect(ray, mesh.view(), actual) == expected.valid());
+        CHECK(actual.prim == expected.prim);
+        if (expected.valid()) {
+            CHECK(actual.t == expected.t);
+            hits++;
+        }
+        CHECK(bvh.occluded(ray, mesh.view()) == expected.valid());
+    }
+    // Make sure the test actually exercised hits.
+    CHECK(hits > 100);
+}
+
+TEST_CASE("degenerate input") {
+    // Identical triangles leave the binner nothing to split on.
+    glpt::Mesh mesh;
+    mesh.positions = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+    mesh.triangles.assign(100, {0, 1, 2});
+    auto bvh = glpt::BVH::build(mesh.view());
+
+    std::vector<int> seen(mesh.triangles.size(), 0);
+    validate(bvh, mesh.view(), 0, seen);
+    CHECK(std::all_of(seen.begin(), seen.end(), [](int n) { return n == 1; }));
+
+    glpt::Hit hit;
+    CHECK(bvh.intersect({{0.25f, 0.25f, 1.0f}, {0.0f, 0.0f, -1.0f}}, mesh.view(), hit));
+    CHECK(hit.t == doctest::Approx(1.0f));
+}
+
+TEST_CASE("refit matches a fresh build") {
+    auto mesh = glpt::makeTriangleSoup(5000, 4);
+    auto bvh  = glpt::BVH::build(mesh.view());
+    jitter(mesh, 0.05f, 5);
+    bvh.refit(mesh.view());
+    auto fresh = glpt::BVH::build(mesh.view());
+
+    std::vector<int> seen(mesh.triangles.size(), 0);
+    validate(bvh, mesh.view(), 0, seen);
+    CHECK(std::all_of(seen.begin(), seen.end(), [](int n) { return n == 1; }));
+    CHECK(bvh.bounds().min == fresh.bounds().min);
+    CHECK(bvh.bounds().max == fresh.bounds().max);
+
+    int hits = 0;
+    for (const auto &ray : randomRays(2000, 6)) {
+        glpt::Hit expected, actual;
+        CHECK(bvh.intersect(ray, mesh.view(), actual) ==
+              fresh.intersect(ray, mesh.view(), expected));
+        CHECK(actual.prim == expected.prim);
+        if (expected.valid()) {
+            CHECK(actual.t == expected.t);
+            hits++;
+        }
+        CHECK(bvh.occluded(ray, mesh.view()) == expected.valid());
+    }
+    CHECK(hits > 100);
+}
+
+TEST_CASE("update rebuilds only once the tree degrades") {
+    auto  mesh  = glpt::makeTriangleSoup(5000, 7);
+    auto  bvh   = glpt::BVH::build(mesh.view());
+    float built = bvh.sahCost();
+    CHECK(built > 0.0f);
+
+    // Small motion keeps the tree good enough to refit.
+    jitter(mesh, 0.002f, 8);
+    CHECK(bvh.update(mesh.view()) == glpt::BVHUpdate::Refit);
+    CHECK(bvh.sahCost() <= built * 1.3f);
+
+    // Scattering every triangle to a new spot leaves the old tree useless.
+    mesh.positions = glpt::makeTriangleSoup(5000, 9).positions;
+    CHECK(bvh.update(mesh.view()) == glpt::BVHUpdate::Rebuild);
+    CHECK(bvh.sahCost() == glpt::BVH::build(mesh.view()).sahCost());
+
+    std::vector<int> seen(mesh.triangles.size(), 0);
+    validate(bvh, mesh.view(), 0, seen);
+    CHECK(std::all_of(seen.begin(), seen.end(), [](int n) { return n == 1; }));
+}
+
+TEST_CASE("build and refit over primitive bounds") {
+    std::vector<glpt::AABB> boxes(1000);
+    glpt::Pcg32             rng(10);
+    for (auto &box : boxes) {
+        glm::vec3 center{rng.nextFloat(), rng.nextFloat(), rng.nextFloat()};
+        box.grow(center - 0.01f);
+        box.grow(center + 0.01f);
+    }
+    auto bvh = glpt::BVH::build(boxes);
+    for (auto &box : boxes) {
+        box.min.x += 0.5f;
+        box.max.x += 0.5f;
+    }
+    CHECK(bvh.update(boxes) == glpt::BVHUpdate::Refit);
+
+    std::vector<int> seen(boxes.size(), 0);
+    for (const auto &node : bvh.nodes()) {
+        if (!node.isLeaf()) continue;
+        for (uint32_t i = node.offset; i < node.offset + node.count; i++) {
+            uint32_t prim = bvh.primIndices()[i];
+            seen[prim]++;
+            CHECK(node.bounds().contains(boxes[prim]));
+        }
+    }
+    CHECK(std::all_of(seen.begin(), seen.end(), [](int n) { return n == 1; }));
+}
+
+TEST_CASE("refit rejects a different primitive count") {
+    auto mesh = glpt::makeTriangleSoup(100, 11);
+    auto bvh  = glpt::BVH::build(mesh.view());
+    mesh.triangles.pop_back();
+    CHECK_THROWS_AS(bvh.refit(mesh.view()), std::invalid_argument);
+    CHECK_THROWS_AS(bvh.update(mesh.view()), std::invalid_argument);
+
+    std::vector<glpt::AABB> boxes(3);
+    for (auto &box : boxes) {
+        box.grow(glm::vec3{0.0f});
+    }
+    auto boxBvh = glpt::BVH::build(boxes);
+    boxes.emplace_back();
+    CHECK_THROWS_AS(boxBvh.refit(boxes), std::invalid_argument);
+    CHECK_THROWS_AS(boxBvh.update(boxes), std::invalid_argument);
+
+    // An empty tree is simply built by update().
+    glpt::BVH empty;
+    CHECK(empty.update(mesh.view()) == glpt::BVHUpdate::Rebuild);
+    CHECK(empty.primIndices().size() == mesh.triangles.size());
+}
+
+TEST_CASE("centroids a denormal apart") {
+    // Binning along an extent this small would scale by infinity. The builder has to treat the
+    // centroids as coincident instead.
+    glpt::Mesh mesh;
+    for (uint32_t i = 0; i < 40; i++) {
+        float x = static_cast<float>(i) * 1e-40f;
+        auto  v = static_cast<uint32_t>(mesh.positions.size());
+        mesh.positions.insert(
+            mesh.positions.end(), {{x, 0.0f, 0.0f}, {x, 1.0f, 0.0f}, {x, 0.0f, 1.0f}});
+        mesh.triangles.push_back({v, v + 1, v + 2});
+    }
+    auto bvh = glpt::BVH::build(mesh.view());
+
+    std::vector<int> seen(mesh.triangles.size(), 0);
+    validate(bvh, mesh.view(), 0, seen);
+    CHECK(std::all_of(seen.begin(), seen.end(), [](int n) { return n == 1; }));
+    glpt::Hit hit;
+    CHECK(bvh.intersect({{1.0f, 0.25f, 0.25f}, {-1.0f, 0.0f, 0.0f}}, mesh.view(), hit));
+}
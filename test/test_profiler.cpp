@@ -0,0 +1,118 @@
+//
+// Created by taylor-santos on 10/16/2026 at 23:55.
+//
+
+#include "doctest/doctest.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "alloc_counter.hpp"
+#include "procedural.hpp"
+#include "profiler.hpp"
+#include "renderer.hpp"
+
+TEST_SUITE_BEGIN("profiler");
+
+TEST_CASE("zones and counters cover a render") {
+    namespace profile = glpt::profile;
+    auto                 scene = glpt::makeCornellBox();
+    glpt::RenderSettings settings;
+    settings.width           = 32;
+    settings.height          = 32;
+    settings.samplesPerPixel = 2;
+    settings.tileSize        = 8;
+    glpt::ThreadPool pool(3);
+
+    profile::reset();
+    profile::setTracing(true);
+    (void)glpt::render(scene.view(), settings, pool);
+    profile::setTracing(false);
+    auto stats = profile::stats();
+
+    if constexpr (profile::enabled) {
+        CHECK(stats.total(profile::Zone::RenderTile).calls == 16);
+        CHECK(stats.total(profile::Zone::RenderTile).nanoseconds > 0);
+        // Shading is recorded once per tile, not once per path vertex.
+        CHECK(stats.total(profile::Zone::Shade).calls == 16);
+        // Every camera ray is traced, plus bounces.
+        CHECK(stats.total(profile::Counter::Rays) >= 32 * 32 * 2);
+        CHECK(stats.total(profile::Counter::ShadowRays) > 0);
+        CHECK(stats.total(profile::Counter::NodeVisits) >= stats.total(profile::Counter::Rays));
+        CHECK(stats.total(profile::Counter::TriangleTests) > 0);
+    } else {
+        CHECK(stats.total(profile::Zone::RenderTile).calls == 0);
+        CHECK(stats.total(profile::Counter::Rays) == 0);
+    }
+
+    std::string path = "glpt_test_trace.json";
+    REQUIRE(profile::writeChromeTrace(path));
+    std::ifstream     file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    file.close();
+    std::remove(path.c_str());
+    CHECK(contents.str().rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0) == 0);
+    CHECK((contents.str().find("\"Render tile\"") != std::string::npos) == profile::enabled);
+    CHECK(contents.str().find("\"Shade\"") == std::string::npos);
+
+    profile::reset();
+    CHECK(profile::stats().total(profile::Counter::Rays) == 0);
+}
+
+TEST_CASE("recording does not allocate after reset and setTracing") {
+    namespace profile = glpt::profile;
+    // More threads than earlier tests left records behind for, so that some claim new ones. Each
+    // thread waits for the others around the counted part, because exiting releases its record.
+    constexpr int            threadCount = 16;
+    std::atomic<int>         ready{0};
+    std::atomic<int>         done{0};
+    std::atomic<bool>        record{false};
+    std::atomic<bool>        leave{false};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; i++) {
+        threads.emplace_back([&] {
+            profile::reset();
+            ready++;
+            while (!record) std::this_thread::yield();
+            {
+                GLPT_PROFILE_SCOPE(profile::Zone::RenderTile);
+            }
+            done++;
+            while (!leave) std::this_thread::yield();
+        });
+    }
+    while (ready < threadCount) std::this_thread::yield();
+    profile::setTracing(true);
+    {
+        glpt::test::AllocationCounter counter;
+        record = true;
+        while (done < threadCount) std::this_thread::yield();
+        CHECK(counter.count() == 0);
+    }
+    leave = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    profile::setTracing(false);
+    if constexpr (profile::enabled) {
+        CHECK(profile::stats().total(profile::Zone::RenderTile).calls == threadCount);
+    }
+    profile::reset();
+}
+
+TEST_CASE("every zone and counter has a name") {
+    for (std::size_t i = 0; i < glpt::profile::zoneCount; i++) {
+        CHECK(std::string(glpt::profile::name(static_cast<glpt::profile::Zone>(i))) != "?");
+    }
+    for (std::size_t i = 0; i < glpt::profile::counterCount; i++) {
+        CHECK(std::string(glpt::profile::name(static_cast<glpt::profile::Counter>(i))) != "?");
+    }
+}
+
+TEST_SUITE_END();
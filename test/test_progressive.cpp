@@ -0,0 +1,110 @@
+//
+// Created by taylor-santos on 10/16/2026 at 18:20.
+//
+
+#include "doctest/doctest.h"
+
+#include <atomic>
+#include <thread>
+
+#include "procedural.hpp"
+#include "progressive.hpp"
+#include "renderer.hpp"
+
+TEST_SUITE_BEGIN("progressive");
+
+TEST_CASE("passes accumulate to the one-shot render") {
+    auto                      scene = glpt::makeCornellBox();
+    glpt::ProgressiveSettings settings;
+    settings.width          = 40;
+    settings.height         = 24;
+    settings.tileSize       = 8;
+    settings.samplesPerPass = 2;
+
+    glpt::ThreadPool          pool(3);
+    glpt::ProgressiveRenderer renderer(settings);
+    uint64_t                  traced = 0;
+    for (int pass = 0; pass < 3; pass++) {
+        traced += renderer.renderPass(scene.view(), pool);
+    }
+    CHECK(renderer.passes() == 3);
+    CHECK(traced == 40 * 24 * 6);
+    CHECK_FALSE(renderer.converged());
+
+    glpt::Image image;
+    renderer.snapshot(image);
+
+    glpt::RenderSettings reference;
+    reference.width           = settings.width;
+    reference.height          = settings.height;
+    reference.samplesPerPixel = 6;
+    CHECK(image.pixels == glpt::render(scene.view(), reference, pool).pixels);
+
+    renderer.reset();
+    CHECK(renderer.passes() == 0);
+    renderer.snapshot(image);
+    for (const auto &p : image.pixels) {
+        REQUIRE(p == glm::vec3{0.0f});
+    }
+}
+
+TEST_CASE("adaptive sampling stops converged pixels") {
+    // A lone emitter filling the view is noise-free, so every pixel converges after minSamples.
+    glpt::Scene    scene;
+    glpt::Material light{{0.5f, 0.5f, 0.5f}, {1.0f, 2.0f, 3.0f}};
+    scene.add(glpt::makeQuad({-10, -10, -1}, {10, -10, -1}, {10, 10, -1}, {-10, 10, -1}), light);
+    scene.commit();
+
+    glpt::ProgressiveSettings settings;
+    settings.width          = 16;
+    settings.height         = 16;
+    settings.errorThreshold = 0.01f;
+    settings.minSamples     = 4;
+
+    glpt::ThreadPool          pool(2);
+    glpt::ProgressiveRenderer renderer(settings);
+    uint64_t                  traced = 0;
+    for (int pass = 0; pass < 8; pass++) {
+        traced += renderer.renderPass(scene.view(), pool);
+    }
+    CHECK(renderer.converged());
+    CHECK(traced == 16 * 16 * 4);
+
+    glpt::Image image;
+    renderer.snapshot(image);
+    CHECK(image.at(8, 8).x == doctest::Approx(1.0f));
+    CHECK(image.at(8, 8).z == doctest::Approx(3.0f));
+}
+
+TEST_CASE("snapshots run concurrently with passes") {
+    auto                      scene = glpt::makeCornellBox();
+    glpt::ProgressiveSettings settings;
+    settings.width    = 32;
+    settings.height   = 32;
+    settings.tileSize = 4;
+
+    glpt::ThreadPool          pool(2);
+    glpt::ProgressiveRenderer renderer(settings);
+    std::atomic<bool>         done{false};
+    std::thread               viewer([&] {
+        glpt::Image image;
+        while (!done.load()) {
+            renderer.snapshot(image);
+        }
+    });
+    for (int pass = 0; pass < 4; pass++) {
+        renderer.renderPass(scene.view(), pool);
+    }
+    done = true;
+    viewer.join();
+
+    glpt::Image image;
+    renderer.snapshot(image);
+    glpt::RenderSettings reference;
+    reference.width           = settings.width;
+    reference.height          = settings.height;
+    reference.samplesPerPixel = 4;
+    CHECK(image.pixels == glpt::render(scene.view(), reference, pool).pixels);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,252 @@
+//
+// Created by taylor-santos on 10/16/2026 at 21:40.
+//
+
+#include "doctest/doctest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "obj.hpp"
+#include "procedural.hpp"
+#include "renderer.hpp"
+#include "scene_file.hpp"
+
+namespace {
+
+// In the working directory, like the other tests' scratch files.
+std::string
+tempPath(const std::string &name) {
+    return "glpt_test_" + name;
+}
+
+// Writes a scene with one triangle and the given hand-made BVH over it.
+bool
+writeSingleTriangle(const std::string &path, glpt::span<const glpt::BVHNode> nodes) {
+    glpt::Mesh mesh;
+    mesh.positions = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+    mesh.triangles = {{0, 1, 2}};
+    std::vector<uint32_t> primIndices{0};
+    std::vector<uint32_t> materials{0};
+    glpt::Material        material;
+
+    glpt::SceneView view;
+    view.mesh              = mesh.view();
+    view.bvh               = {nodes, primIndices};
+    view.materials         = {&material, 1};
+    view.triangleMaterials = materials;
+    return glpt::writeSceneFile(view, path);
+}
+
+template<typename T>
+bool
+sameBytes(glpt::span<const T> a, glpt::span<const T> b) {
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size_bytes()) == 0;
+}
+
+std::string
+readAll(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+void
+writeAll(const std::string &path, const std::string &contents) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << contents;
+}
+
+} // namespace
+
+TEST_SUITE_BEGIN("scene_file");
+
+TEST_CASE("round trip") {
+    auto scene = glpt::makeCornellBox();
+    auto view  = scene.view();
+    // The wide BVH is not stored, so compare against the binary traversal.
+    view.wideBvh = nullptr;
+    auto path    = tempPath("roundtrip.glpt");
+    REQUIRE(glpt::writeSceneFile(view, path));
+
+    {
+        glpt::SceneFile file(path);
+        const auto     &loaded = file.view();
+        CHECK(sameBytes(loaded.mesh.positions, view.mesh.positions));
+        CHECK(sameBytes(loaded.mesh.triangles, view.mesh.triangles));
+        CHECK(sameBytes(loaded.materials, view.materials));
+        CHECK(sameBytes(loaded.triangleMaterials, view.triangleMaterials));
+        CHECK(sameBytes(loaded.lights, view.lights));
+        CHECK(sameBytes(loaded.bvh.nodes, view.bvh.nodes));
+        CHECK(sameBytes(loaded.bvh.primIndices, view.bvh.primIndices));
+        CHECK(loaded.camera.position == view.camera.position);
+        CHECK(loaded.wideBvh == nullptr);
+        // Zero-copy: the spans must point into the mapping, 64-byte aligned.
+        CHECK(reinterpret_cast<uintptr_t>(loaded.bvh.nodes.data()) % 64 == 0);
+        CHECK_NOTHROW(file.verify());
+
+        glpt::RenderSettings settings;
+        settings.width           = 16;
+        settings.height          = 16;
+        settings.samplesPerPixel = 2;
+        glpt::ThreadPool pool(2);
+        auto expected = glpt::render(view, settings, pool);
+        CHECK(glpt::render(loaded, settings, pool).pixels == expected.pixels);
+    }
+    {
+        // The wide BVH built at load matches the one built with the scene.
+        glpt::SceneFileOptions options;
+        options.buildWideBvh = true;
+        glpt::SceneFile file(path, options);
+        const auto     &loaded = file.view();
+        REQUIRE(loaded.wideBvh != nullptr);
+        CHECK(loaded.wideBvh->nodes().size() == scene.wideBvh.nodes().size());
+
+        glpt::RenderSettings settings;
+        settings.width           = 16;
+        settings.height          = 16;
+        settings.samplesPerPixel = 2;
+        glpt::ThreadPool pool(2);
+        auto expected = glpt::render(scene.view(), settings, pool);
+        CHECK(glpt::render(loaded, settings, pool).pixels == expected.pixels);
+    }
+    std::remove(path.c_str());
+}
+
+TEST_CASE("invalid files are rejected") {
+    auto scene = glpt::makeCornellBox();
+    auto path  = tempPath("invalid.glpt");
+    REQUIRE(glpt::writeSceneFile(scene.view(), path));
+    const std::string good = readAll(path);
+
+    CHECK_THROWS_AS(glpt::SceneFile(tempPath("does_not_exist.glpt")), std::runtime_error);
+
+    SUBCASE("truncated header") {
+        writeAll(path, good.substr(0, 10));
+        CHECK_THROWS_AS(glpt::SceneFile{path}, std::runtime_error);
+    }
+    SUBCASE("truncated data") {
+        writeAll(path, good.substr(0, good.size() - 4));
+        CHECK_THROWS_AS(glpt::SceneFile{path}, std::runtime_error);
+    }
+    SUBCASE("bad magic") {
+        std::string bad = good;
+        bad[0]          = 'X';
+        writeAll(path, bad);
+        CHECK_THROWS_AS(glpt::SceneFile{path}, std::runtime_error);
+    }
+    SUBCASE("future version") {
+        std::string bad     = good;
+        uint32_t    version = glpt::SceneFileHeader::currentVersion + 1;
+        std::memcpy(bad.data() + offsetof(glpt::SceneFileHeader, version), &version, 4);
+        writeAll(path, bad);
+        CHECK_THROWS_AS(glpt::SceneFile{path}, std::runtime_error);
+    }
+    SUBCASE("corrupt index") {
+        std::string           bad = good;
+        glpt::SceneFileHeader header;
+        std::memcpy(&header, bad.data(), sizeof(header));
+        auto     triangles = header.sections[static_cast<int>(glpt::SceneSection::Triangles)];
+        uint32_t huge      = 1u << 30u;
+        std::memcpy(bad.data() + triangles.offset, &huge, 4);
+        writeAll(path, bad);
+        CHECK_THROWS_AS(glpt::SceneFile{path}, std::runtime_error);
+
+        // Skipping verification at load still leaves it available on demand.
+        glpt::SceneFileOptions options;
+        options.verify = false;
+        glpt::SceneFile file(path, options);
+        CHECK_THROWS_AS(file.verify(), std::runtime_error);
+    }
+    SUBCASE("corrupt BVH node") {
+        std::string           bad = good;
+        glpt::SceneFileHeader header;
+        std::memcpy(&header, bad.data(), sizeof(header));
+        auto     nodes  = header.sections[static_cast<int>(glpt::SceneSection::BVHNodes)];
+        uint32_t huge   = 1u << 30u;
+        auto     offset = nodes.offset + offsetof(glpt::BVHNode, offset);
+        std::memcpy(bad.data() + offset, &huge, 4);
+        writeAll(path, bad);
+        CHECK_THROWS_AS(glpt::SceneFile{path}, std::runtime_error);
+    }
+    SUBCASE("BVH deeper than traversal supports") {
+        // A chain of interior nodes, each with a leaf on the left and the rest of the chain on
+        // the right, which would overflow the traversal stack.
+        std::vector<glpt::BVHNode> chain;
+        for (uint32_t level = 0; level <= glpt::BVHView::maxDepth; level++) {
+            auto index = static_cast<uint32_t>(chain.size());
+            chain.push_back({{0.0f, 0.0f, 0.0f}, index + 2, {1.0f, 1.0f, 0.0f}, 0});
+            chain.push_back({{0.0f, 0.0f, 0.0f}, 0, {1.0f, 1.0f, 0.0f}, 1});
+        }
+        chain.push_back({{0.0f, 0.0f, 0.0f}, 0, {1.0f, 1.0f, 0.0f}, 1});
+        REQUIRE(writeSingleTriangle(path, chain));
+        CHECK_THROWS_AS(glpt::SceneFile{path}, std::runtime_error);
+    }
+    SUBCASE("BVH nodes with two parents") {
+        // Nodes 0 and 1 both have node 5 as their right child. Every index is in depth-first
+        // order, but a walk would visit 5 twice; a deep enough DAG like this takes exponential
+        // time to traverse.
+        glpt::BVHNode              leaf{{0.0f, 0.0f, 0.0f}, 0, {1.0f, 1.0f, 0.0f}, 1};
+        std::vector<glpt::BVHNode> shared{
+            {{0.0f, 0.0f, 0.0f}, 5, {1.0f, 1.0f, 0.0f}, 0},
+            {{0.0f, 0.0f, 0.0f}, 5, {1.0f, 1.0f, 0.0f}, 0},
+            {{0.0f, 0.0f, 0.0f}, 4, {1.0f, 1.0f, 0.0f}, 0},
+            leaf,
+            leaf,
+            leaf};
+        REQUIRE(writeSingleTriangle(path, shared));
+        CHECK_THROWS_AS(glpt::SceneFile{path}, std::runtime_error);
+    }
+    std::remove(path.c_str());
+}
+
+TEST_CASE("obj loading") {
+    auto objPath = tempPath("scene.obj");
+    auto mtlPath = tempPath("scene.mtl");
+    writeAll(
+        mtlPath,
+        "newmtl red\n"
+        "Kd 0.8 0.1 0.1\n"
+        "newmtl lamp\n"
+        "Ke 5 4 3 # comment\n");
+    writeAll(
+        objPath,
+        "mtllib glpt_test_scene.mtl\n"
+        "v 0 0 0\n"
+        "v 1 0 0\n"
+        "v 1 1 0\n"
+        "v 0 1 0\n"
+        "f 1 2 3\n" // default material
+        "usemtl red\n"
+        "f 1/1/1 2/2/2 3/3/3 4/4/4\n"
+        "usemtl lamp\n"
+        "f -4//1 -3//1 -2//1\r\n");
+
+    auto scene = glpt::loadObj(objPath);
+    REQUIRE(scene.mesh.positions.size() == 4);
+    REQUIRE(scene.mesh.triangles.size() == 4);
+    CHECK(scene.mesh.triangles[1] == glm::uvec3{0, 1, 2});
+    CHECK(scene.mesh.triangles[2] == glm::uvec3{0, 2, 3});
+    CHECK(scene.mesh.triangles[3] == glm::uvec3{0, 1, 2});
+    REQUIRE(scene.materials.size() == 3);
+    CHECK(scene.triangleMaterials == std::vector<uint32_t>{0, 1, 1, 2});
+    CHECK(scene.materials[1].albedo.x == doctest::Approx(0.8f));
+    CHECK(scene.materials[2].emission == glm::vec3{5.0f, 4.0f, 3.0f});
+
+    scene.commit();
+    CHECK(scene.lights == std::vector<uint32_t>{3});
+
+    writeAll(objPath, "v 0 0 0\nf 1 2 3\n");
+    CHECK_THROWS_AS(glpt::loadObj(objPath), std::runtime_error);
+    writeAll(objPath, "v 0 0 zero\n");
+    CHECK_THROWS_AS(glpt::loadObj(objPath), std::runtime_error);
+
+    std::remove(objPath.c_str());
+    std::remove(mtlPath.c_str());
+}
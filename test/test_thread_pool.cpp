@@ -0,0 +1,57 @@
+//
+// Created by taylor-santos on 10/16/2026 at 16:02.
+//
+
+#include "doctest/doctest.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "thread_pool.hpp"
+
+TEST_SUITE_BEGIN("thread_pool");
+
+TEST_CASE("every task runs exactly once") {
+    for (unsigned threads : {1u, 2u, 5u}) {
+        glpt::ThreadPool pool(threads);
+        CHECK(pool.size() == threads);
+        for (uint32_t count : {0u, 1u, 3u, 10000u}) {
+            std::vector<std::atomic<int>> runs(count);
+            std::atomic<bool>             badWorker{false};
+            pool.parallelFor(count, [&](uint32_t task, unsigned worker) {
+                runs[task].fetch_add(1);
+                if (worker >= threads) badWorker = true;
+            });
+            for (const auto &n : runs) {
+                CHECK(n.load() == 1);
+            }
+            CHECK_FALSE(badWorker.load());
+        }
+    }
+}
+
+TEST_CASE("idle workers steal from a blocked worker") {
+    // Whoever runs task 0 blocks until every other task has finished. Tasks 1..99 are in the same
+    // range as task 0, so the loop only completes if the remaining workers steal them.
+    glpt::ThreadPool pool(4);
+    constexpr int    count = 400;
+    std::atomic<int> finished{0};
+    std::atomic<int> blockedWorker{-1};
+    bool             drained = false;
+    pool.parallelFor(count, [&](uint32_t task, unsigned worker) {
+        if (task == 0) {
+            blockedWorker = static_cast<int>(worker);
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (finished.load() < count - 1 && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::yield();
+            }
+            drained = finished.load() == count - 1;
+        }
+        finished++;
+    });
+    CHECK(drained);
+    CHECK(finished.load() == count);
+    CHECK(blockedWorker.load() >= 0);
+}
@@ -0,0 +1,235 @@
+//
+// Created by taylor-santos on 10/17/2026 at 00:20.
+//
+
+#include "doctest/doctest.h"
+
+#include <cstddef>
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "bvh.hpp"
+#include "integrator.hpp"
+#include "procedural.hpp"
+#include "random.hpp"
+#include "renderer.hpp"
+#include "span.hpp"
+#include "tlas.hpp"
+#include "wavefront.hpp"
+
+namespace {
+
+// Every instance baked into a single world space mesh, as the reference to check a TLAS against.
+struct Flattened {
+    glpt::Mesh            mesh;
+    std::vector<uint32_t> firstTriangle;
+    glpt::BVH             bvh;
+};
+
+Flattened
+flatten(const std::vector<glpt::Mesh> &meshes, glpt::span<const glpt::Instance> instances) {
+    Flattened flat;
+    for (const auto &instance : instances) {
+        const glpt::Mesh &mesh  = meshes[instance.blas];
+        auto              first = static_cast<uint32_t>(flat.mesh.positions.size());
+        flat.firstTriangle.push_back(static_cast<uint32_t>(flat.mesh.triangles.size()));
+        for (const auto &position : mesh.positions) {
+            flat.mesh.positions.emplace_back(instance.transform * glm::vec4(position, 1.0f));
+        }
+        for (const auto &tri : mesh.triangles) {
+            flat.mesh.triangles.push_back(tri + glm::uvec3{first});
+        }
+    }
+    flat.bvh = glpt::BVH::build(flat.mesh.view());
+    return flat;
+}
+
+glm::mat4
+placement(glpt::Pcg32 &rng) {
+    glm::vec3 offset{rng.nextFloat(), rng.nextFloat(), rng.nextFloat()};
+    glm::mat4 transform = glm::translate(glm::mat4(1.0f), offset * 4.0f - 2.0f);
+    transform = glm::rotate(transform, rng.nextFloat() * 6.0f, {0.3f, 1.0f, 0.2f});
+    return glm::scale(transform, glm::vec3{0.5f + rng.nextFloat()});
+}
+
+// Compares closest hits and occlusion against the flattened scene. Transforming the ray instead
+// of the triangles rounds differently, so a ray that grazes an edge may rarely disagree.
+void
+checkAgainstFlattened(const glpt::TLAS &tlas, const Flattened &flat, uint32_t seed) {
+    glpt::Pcg32 rng(seed);
+    int         rays = 2000, hits = 0, mismatches = 0;
+    for (int i = 0; i < rays; i++) {
+        glpt::Ray ray;
+        ray.origin = glm::vec3{rng.nextFloat(), rng.nextFloat(), rng.nextFloat()} * 8.0f - 4.0f;
+        glm::vec3 target{rng.nextFloat(), rng.nextFloat(), rng.nextFloat()};
+        ray.direction = glm::normalize(target * 4.0f - 2.0f - ray.origin);
+
+        glpt::Hit         expected;
+        glpt::InstanceHit actual;
+        bool              hitFlat = flat.bvh.intersect(ray, flat.mesh.view(), expected);
+        if (tlas.intersect(ray, actual) != hitFlat || tlas.occluded(ray) != hitFlat) {
+            mismatches++;
+            continue;
+        }
+        if (!hitFlat) continue;
+        hits++;
+        if (flat.firstTriangle[actual.instance] + actual.prim != expected.prim) {
+            mismatches++;
+            continue;
+        }
+        CHECK(actual.t == doctest::Approx(expected.t).epsilon(1e-4));
+    }
+    CHECK(hits > 200);
+    CHECK(mismatches <= rays / 200);
+}
+
+} // namespace
+
+TEST_SUITE_BEGIN("tlas");
+
+TEST_CASE("instances match the flattened scene") {
+    std::vector<glpt::Mesh> meshes{
+        glpt::makeTriangleSoup(500, 1),
+        glpt::makeBox({0.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 0.5f}, 0.0f)};
+    std::vector<glpt::BVH> bvhs;
+    for (const auto &mesh : meshes) {
+        bvhs.push_back(glpt::BVH::build(mesh.view()));
+    }
+    std::vector<glpt::BLASView> blases;
+    for (std::size_t i = 0; i < meshes.size(); i++) {
+        blases.push_back({meshes[i].view(), bvhs[i].view()});
+    }
+
+    glpt::Pcg32                 rng(2);
+    std::vector<glpt::Instance> instances;
+    for (uint32_t i = 0; i < 40; i++) {
+        instances.push_back({i % 2, placement(rng)});
+    }
+    auto tlas = glpt::TLAS::build(blases, instances);
+    checkAgainstFlattened(tlas, flatten(meshes, tlas.instances()), 3);
+
+    SUBCASE("moving one instance refits the top level") {
+        glm::mat4 moved = glm::translate(instances[7].transform, glm::vec3{0.1f, 0.0f, 0.0f});
+        tlas.setTransform(7, moved);
+        CHECK(tlas.update() == glpt::BVHUpdate::Refit);
+        checkAgainstFlattened(tlas, flatten(meshes, tlas.instances()), 4);
+    }
+    SUBCASE("scattering every instance rebuilds the top level") {
+        for (uint32_t i = 0; i < instances.size(); i++) {
+            tlas.setTransform(i, placement(rng));
+        }
+        CHECK(tlas.update() == glpt::BVHUpdate::Rebuild);
+        checkAgainstFlattened(tlas, flatten(meshes, tlas.instances()), 5);
+    }
+}
+
+TEST_CASE("normals are transformed to world space") {
+    glpt::Mesh mesh;
+    mesh.positions = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}};
+    mesh.triangles = {{0, 1, 2}};
+    auto bvh       = glpt::BVH::build(mesh.view());
+
+    // Squashing a slanted triangle along x tilts its normal the other way, which only the
+    // inverse transpose gets right.
+    glm::mat4 transform = glm::rotate(glm::mat4(1.0f), glm::radians(30.0f), {0.0f, 1.0f, 0.0f});
+    transform           = glm::scale(transform, glm::vec3{0.25f, 1.0f, 1.0f});
+    auto tlas           = glpt::TLAS::build({{mesh.view(), bvh.view()}}, {{0, transform}});
+
+    glm::vec3 v0{transform * glm::vec4(mesh.positions[0], 1.0f)};
+    glm::vec3 v1{transform * glm::vec4(mesh.positions[1], 1.0f)};
+    glm::vec3 v2{transform * glm::vec4(mesh.positions[2], 1.0f)};
+    glm::vec3 expected = glm::normalize(glm::cross(v1 - v0, v2 - v0));
+    glm::vec3 center   = (v0 + v1 + v2) / 3.0f;
+
+    glpt::Ray         ray{center + expected * 2.0f, -expected};
+    glpt::InstanceHit hit;
+    REQUIRE(tlas.intersect(ray, hit));
+    CHECK(hit.instance == 0);
+    CHECK(hit.prim == 0);
+    CHECK(hit.t == doctest::Approx(2.0f));
+    glm::vec3 normal = glm::normalize(tlas.normal(hit));
+    CHECK(normal.x == doctest::Approx(expected.x));
+    CHECK(normal.y == doctest::Approx(expected.y));
+    CHECK(normal.z == doctest::Approx(expected.z));
+}
+
+TEST_CASE("scenes with instances render like the same cubes baked into the mesh") {
+    auto        instanced = glpt::makeInstancedCornellBox(30, 6);
+    glpt::Scene baked     = glpt::makeCornellBox();
+    for (const auto &instance : instanced.tlas.instances()) {
+        glpt::Mesh cube = instanced.blasMesh;
+        for (auto &position : cube.positions) {
+            position = glm::vec3(instance.transform * glm::vec4(position, 1.0f));
+        }
+        baked.add(cube, instanced.scene.materials[instance.material]);
+    }
+    baked.commit();
+    glpt::SceneView instancedView = instanced.view();
+    glpt::SceneView bakedView     = baked.view();
+
+    // Camera rays see the same materials, up to rays that graze an edge (see above).
+    constexpr uint32_t size = 64;
+    uint32_t           hits = 0, mismatches = 0;
+    for (uint32_t y = 0; y < size; y++) {
+        for (uint32_t x = 0; x < size; x++) {
+            glpt::Pcg32       rng = glpt::pixelSampler(y * size + x, 0, 0);
+            glpt::Ray         ray = glpt::primaryRay(bakedView.camera, x, y, size, size, rng);
+            glpt::InstanceHit expected;
+            glpt::InstanceHit actual;
+            bool              hitBaked = bakedView.intersect(ray, expected);
+            if (instancedView.intersect(ray, actual) != hitBaked) {
+                mismatches++;
+                continue;
+            }
+            if (!hitBaked) continue;
+            if (actual.instance != glpt::Hit::invalid) hits++;
+            // Baking gave every cube a material of its own, so compare colors, not indices.
+            if (instancedView.materialOf(actual).albedo != bakedView.materialOf(expected).albedo) {
+                mismatches++;
+            }
+        }
+    }
+    CHECK(hits > 20);
+    CHECK(mismatches <= size * size / 100);
+
+    glpt::RenderSettings settings;
+    settings.width           = 32;
+    settings.height          = 32;
+    settings.samplesPerPixel = 4;
+    glpt::ThreadPool pool(2);
+    auto             image     = glpt::render(instancedView, settings, pool);
+    auto             reference = glpt::render(bakedView, settings, pool);
+
+    // Paths use the same random numbers in both scenes, so the images only drift apart where a
+    // grazing ray sent a path elsewhere.
+    glm::vec3 sum{0.0f};
+    glm::vec3 referenceSum{0.0f};
+    for (std::size_t i = 0; i < image.pixels.size(); i++) {
+        sum += image.pixels[i];
+        referenceSum += reference.pixels[i];
+    }
+    for (int c = 0; c < 3; c++) {
+        CHECK(sum[c] == doctest::Approx(referenceSum[c]).epsilon(0.02));
+    }
+
+    SUBCASE("the wavefront integrator matches the megakernel") {
+        glpt::WavefrontRenderer wavefront;
+        CHECK(wavefront.render(instancedView, settings, pool).pixels == image.pixels);
+    }
+}
+
+TEST_CASE("empty BLASes and empty TLASes") {
+    glpt::Mesh empty;
+    auto       bvh = glpt::BVH::build(empty.view());
+
+    glpt::TLAS        none;
+    glpt::InstanceHit hit;
+    CHECK_FALSE(none.intersect({}, hit));
+    CHECK_FALSE(none.occluded({}));
+
+    auto tlas = glpt::TLAS::build({{empty.view(), bvh.view()}}, {{0, glm::mat4(1.0f)}});
+    CHECK_FALSE(tlas.intersect({}, hit));
+    CHECK_FALSE(tlas.occluded({}));
+    CHECK(tlas.update() == glpt::BVHUpdate::Refit);
+}
@@ -0,0 +1,59 @@
+//
+// Created by taylor-santos on 10/16/2026 at 20:15.
+//
+
+#include "doctest/doctest.h"
+
+#include "procedural.hpp"
+#include "renderer.hpp"
+#include "wavefront.hpp"
+
+TEST_SUITE_BEGIN("wavefront");
+
+TEST_CASE("matches the megakernel renderer") {
+    auto                 scene = glpt::makeCornellBox();
+    glpt::RenderSettings settings;
+    settings.width           = 37;
+    settings.height          = 23;
+    settings.samplesPerPixel = 3;
+
+    glpt::ThreadPool pool(3);
+    auto             reference = glpt::render(scene.view(), settings, pool);
+
+    SUBCASE("single wave") {
+        glpt::WavefrontRenderer renderer;
+        CHECK(renderer.render(scene.view(), settings, pool).pixels == reference.pixels);
+    }
+    SUBCASE("many waves that split the image mid-row") {
+        glpt::WavefrontRenderer renderer({100, true});
+        CHECK(renderer.render(scene.view(), settings, pool).pixels == reference.pixels);
+        // Buffers are reused by the next frame.
+        CHECK(renderer.render(scene.view(), settings, pool).pixels == reference.pixels);
+    }
+    SUBCASE("unsorted queues") {
+        glpt::WavefrontRenderer renderer({1000, false});
+        CHECK(renderer.render(scene.view(), settings, pool).pixels == reference.pixels);
+    }
+    SUBCASE("single thread") {
+        glpt::ThreadPool        single(1);
+        glpt::WavefrontRenderer renderer;
+        CHECK(renderer.render(scene.view(), settings, single).pixels == reference.pixels);
+    }
+}
+
+TEST_CASE("empty scene") {
+    glpt::Scene scene;
+    scene.commit();
+    glpt::RenderSettings settings;
+    settings.width  = 8;
+    settings.height = 8;
+
+    glpt::ThreadPool        pool(2);
+    glpt::WavefrontRenderer renderer;
+    auto                    image = renderer.render(scene.view(), settings, pool);
+    for (const auto &pixel : image.pixels) {
+        CHECK(pixel == glm::vec3{0.0f});
+    }
+}
+
+TEST_SUITE_END();
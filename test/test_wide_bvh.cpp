@@ -0,0 +1,122 @@
+//
+// Created by taylor-santos on 10/16/2026 at 18:40.
+//
+
+#include "doctest/doctest.h"
+
+#include <vector>
+
+#include "bvh.hpp"
+#include "procedural.hpp"
+#include "random.hpp"
+#include "wide_bvh.hpp"
+
+namespace {
+
+template<int W>
+void
+checkAgainst(
+    const glpt::BVH        &bvh,
+    const glpt::WideBVH<W> &wide,
+    const glpt::Mesh       &mesh,
+    uint32_t                seed) {
+    glpt::Pcg32 rng(seed);
+    int         hits = 0;
+    for (int i = 0; i < 2000; i++) {
+        glpt::Ray ray;
+        ray.origin = glm::vec3{rng.nextFloat(), rng.nextFloat(), rng.nextFloat()} * 3.0f - 1.0f;
+        glm::vec3 target{rng.nextFloat(), rng.nextFloat(), rng.nextFloat()};
+        ray.direction = glm::normalize(target - ray.origin);
+        if (i % 4 == 0) ray.tMax = rng.nextFloat() * 2.0f;
+
+        glpt::Hit expected, actual;
+        bool      hitBinary = bvh.intersect(ray, mesh.view(), expected);
+        REQUIRE(wide.intersect(ray, actual) == hitBinary);
+        CHECK(wide.occluded(ray) == hitBinary);
+        if (hitBinary) {
+            hits++;
+            CHECK(actual.t == doctest::Approx(expected.t));
+            CHECK(actual.u == doctest::Approx(expected.u));
+            CHECK(actual.v == doctest::Approx(expected.v));
+            CHECK(actual.prim == expected.prim);
+        }
+    }
+    CHECK(hits > 100);
+}
+
+template<int W>
+void
+checkAgainstBinary(const glpt::Mesh &mesh, uint32_t seed) {
+    auto bvh = glpt::BVH::build(mesh.view());
+    checkAgainst(bvh, glpt::WideBVH<W>::build(bvh.view(), mesh.view()), mesh, seed);
+}
+
+} // namespace
+
+TEST_SUITE_BEGIN("wide_bvh");
+
+TEST_CASE("4-wide matches the binary BVH") {
+    checkAgainstBinary<4>(glpt::makeTriangleSoup(3000, 11), 12);
+}
+
+TEST_CASE("8-wide matches the binary BVH") {
+    checkAgainstBinary<8>(glpt::makeTriangleSoup(3000, 13), 14);
+}
+
+TEST_CASE("refit follows moved vertices") {
+    auto mesh = glpt::makeTriangleSoup(3000, 19);
+    auto bvh  = glpt::BVH::build(mesh.view());
+    auto wide = glpt::WideBVH<8>::build(bvh.view(), mesh.view());
+
+    glpt::Pcg32 rng(20);
+    for (auto &position : mesh.positions) {
+        position += glm::vec3{rng.nextFloat(), rng.nextFloat(), rng.nextFloat()} * 0.1f - 0.05f;
+    }
+    bvh.refit(mesh.view());
+    wide.refit(mesh.view());
+    checkAgainst(bvh, wide, mesh, 21);
+}
+
+TEST_CASE("small and empty meshes") {
+    glpt::Mesh empty;
+    auto       wide = glpt::WideBVH<8>::build(glpt::BVH::build(empty.view()).view(), empty.view());
+    CHECK(wide.empty());
+    glpt::Hit hit;
+    CHECK_FALSE(wide.intersect({}, hit));
+
+    // A single leaf root still needs a wide root node above it.
+    checkAgainstBinary<4>(glpt::makeTriangleSoup(3, 15), 16);
+    checkAgainstBinary<8>(glpt::makeTriangleSoup(20, 17), 18);
+}
+
+TEST_CASE("every triangle lands in exactly one packet lane") {
+    auto             mesh = glpt::makeTriangleSoup(1000, 19);
+    auto             bvh  = glpt::BVH::build(mesh.view());
+    auto             wide = glpt::WideBVH<4>::build(bvh.view(), mesh.view());
+    std::vector<int> seen(mesh.triangles.size(), 0);
+    for (const auto &packet : wide.packets()) {
+        for (uint32_t prim : packet.prim) {
+            if (prim != glpt::Hit::invalid) seen[prim]++;
+        }
+    }
+    for (int n : seen) {
+        CHECK(n == 1);
+    }
+}
+
+TEST_CASE("simd primitives") {
+    using F             = glpt::simd::Float<4>;
+    float    a[4]       = {1.0f, -2.0f, 3.0f, 4.0f};
+    float    b[4]       = {2.0f, -3.0f, 3.0f, 0.5f};
+    F        x          = glpt::simd::load<4>(a);
+    F        y          = glpt::simd::load<4>(b);
+    float    out[4];
+    glpt::simd::store(glpt::simd::min(x, y) * glpt::simd::splat<4>(2.0f), out);
+    CHECK(out[0] == 2.0f);
+    CHECK(out[1] == -6.0f);
+    CHECK(out[2] == 6.0f);
+    CHECK(out[3] == 1.0f);
+    CHECK(glpt::simd::bits(x < y) == 0b0001u);
+    CHECK(glpt::simd::bits(x <= y) == 0b0101u);
+    CHECK(glpt::simd::bits((x > y) | (x < y)) == 0b1011u);
+}